@@ -0,0 +1,193 @@
+#include "AllocationTracker.hpp"
+#include <cstdlib>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    std::atomic<size_t> liveBytes{0};
+    std::atomic<size_t> peakBytes{0};
+    std::atomic<size_t> allocationCount{0};
+    std::atomic<size_t> deallocationCount{0};
+
+#if defined(__GLIBC__)
+    // Cada bloco do malloc da glibc carrega uma palavra de cabeçalho
+    constexpr size_t CHUNK_HEADER = sizeof(size_t);
+
+    void *rawAllocate(size_t size, size_t alignment)
+    {
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            return std::malloc(size);
+        }
+        void *memory = nullptr;
+        return posix_memalign(&memory, alignment, size) == 0 ? memory : nullptr;
+    }
+
+    size_t blockSize(void *memory)
+    {
+        return malloc_usable_size(memory) + CHUNK_HEADER;
+    }
+
+    void rawRelease(void *memory)
+    {
+        std::free(memory);
+    }
+#else
+    // Sem malloc_usable_size: um prefixo guarda o tamanho pedido e o deslocamento
+    struct Prefix
+    {
+        size_t size;
+        size_t offset;
+    };
+
+    void *rawAllocate(size_t size, size_t alignment)
+    {
+        size_t offset = alignment < alignof(std::max_align_t) ? alignof(std::max_align_t) : alignment;
+        if (offset < sizeof(Prefix))
+        {
+            offset = sizeof(Prefix);
+        }
+        char *base = static_cast<char *>(std::aligned_alloc(offset, (offset + size + offset - 1) / offset * offset));
+        if (base == nullptr)
+        {
+            return nullptr;
+        }
+        Prefix *prefix = reinterpret_cast<Prefix *>(base + offset) - 1;
+        prefix->size = size;
+        prefix->offset = offset;
+        return base + offset;
+    }
+
+    size_t blockSize(void *memory)
+    {
+        const Prefix *prefix = static_cast<Prefix *>(memory) - 1;
+        return prefix->size + prefix->offset;
+    }
+
+    void rawRelease(void *memory)
+    {
+        const Prefix *prefix = static_cast<Prefix *>(memory) - 1;
+        std::free(static_cast<char *>(memory) - prefix->offset);
+    }
+#endif
+
+    void *trackedNew(size_t size, size_t alignment)
+    {
+        if (size == 0)
+        {
+            size = 1;
+        }
+
+        void *memory;
+        while ((memory = rawAllocate(size, alignment)) == nullptr)
+        {
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+
+        AllocationTracker::recordAllocation(blockSize(memory));
+        return memory;
+    }
+
+    void *trackedNewNothrow(size_t size, size_t alignment) noexcept
+    {
+        try
+        {
+            return trackedNew(size, alignment);
+        }
+        catch (const std::bad_alloc &)
+        {
+            return nullptr;
+        }
+    }
+
+    void trackedDelete(void *memory) noexcept
+    {
+        if (memory == nullptr)
+        {
+            return;
+        }
+        AllocationTracker::recordRelease(blockSize(memory));
+        rawRelease(memory);
+    }
+}
+
+void AllocationTracker::recordAllocation(size_t bytes)
+{
+    size_t now = liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t previous = peakBytes.load(std::memory_order_relaxed);
+    while (now > previous && !peakBytes.compare_exchange_weak(previous, now, std::memory_order_relaxed))
+    {
+    }
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordRelease(size_t bytes)
+{
+    liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    deallocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocationTracker::Snapshot AllocationTracker::snapshot()
+{
+    return {liveBytes.load(std::memory_order_relaxed), peakBytes.load(std::memory_order_relaxed),
+            allocationCount.load(std::memory_order_relaxed), deallocationCount.load(std::memory_order_relaxed)};
+}
+
+void AllocationTracker::resetPeak()
+{
+    peakBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+AllocationTracker::Phase::Phase()
+{
+    resetPeak();
+    start = snapshot();
+}
+
+AllocationTracker::PhaseStats AllocationTracker::Phase::finish() const
+{
+    Snapshot end = snapshot();
+    PhaseStats stats;
+    stats.retainedBytes = static_cast<int64_t>(end.liveBytes) - static_cast<int64_t>(start.liveBytes);
+    stats.peakBytes = end.peakBytes > start.liveBytes ? end.peakBytes - start.liveBytes : 0;
+    stats.allocations = end.allocations - start.allocations;
+    return stats;
+}
+
+// ========== Operadores globais ==========
+
+void *operator new(size_t size) { return trackedNew(size, 0); }
+void *operator new[](size_t size) { return trackedNew(size, 0); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return trackedNewNothrow(size, 0); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return trackedNewNothrow(size, 0); }
+void *operator new(size_t size, std::align_val_t alignment) { return trackedNew(size, static_cast<size_t>(alignment)); }
+void *operator new[](size_t size, std::align_val_t alignment) { return trackedNew(size, static_cast<size_t>(alignment)); }
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return trackedNewNothrow(size, static_cast<size_t>(alignment));
+}
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return trackedNewNothrow(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void *memory) noexcept { trackedDelete(memory); }
+void operator delete[](void *memory) noexcept { trackedDelete(memory); }
+void operator delete(void *memory, size_t) noexcept { trackedDelete(memory); }
+void operator delete[](void *memory, size_t) noexcept { trackedDelete(memory); }
+void operator delete(void *memory, const std::nothrow_t &) noexcept { trackedDelete(memory); }
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { trackedDelete(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { trackedDelete(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { trackedDelete(memory); }
+void operator delete(void *memory, size_t, std::align_val_t) noexcept { trackedDelete(memory); }
+void operator delete[](void *memory, size_t, std::align_val_t) noexcept { trackedDelete(memory); }
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept { trackedDelete(memory); }
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept { trackedDelete(memory); }
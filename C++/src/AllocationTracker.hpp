@@ -0,0 +1,125 @@
+#ifndef ALLOCATIONTRACKER_HPP
+#define ALLOCATIONTRACKER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * Contabilidade real de memória
+ * Os operadores globais new/delete (AllocationTracker.cpp) registram cada
+ * alocação com o tamanho efetivamente entregue pelo malloc, incluindo o
+ * cabeçalho do bloco; páginas mapeadas diretamente (mmap/mremap) são
+ * registradas por quem as mapeia. Os contadores são atômicos e globais.
+ */
+class AllocationTracker
+{
+public:
+    struct Snapshot
+    {
+        size_t liveBytes;
+        size_t peakBytes;
+        size_t allocations;
+        size_t deallocations;
+    };
+
+    // Consumo de uma fase, relativo ao início dela
+    struct PhaseStats
+    {
+        int64_t retainedBytes; // Vivos ao fim - vivos no início
+        size_t peakBytes;      // Pico acima do nível do início
+        size_t allocations;
+    };
+
+    /**
+     * Mede uma fase: o pico global é reiniciado na construção
+     * Fases não devem ser aninhadas
+     */
+    class Phase
+    {
+    private:
+        Snapshot start;
+
+    public:
+        Phase();
+        PhaseStats finish() const;
+    };
+
+    static Snapshot snapshot();
+
+    // Usados pelos operadores globais e por armazenamento fora do heap (mmap)
+    static void recordAllocation(size_t bytes);
+    static void recordRelease(size_t bytes);
+
+private:
+    static void resetPeak();
+};
+
+/**
+ * Contador por instância para CountingAllocator
+ */
+class AllocationCounter
+{
+private:
+    std::atomic<size_t> live{0};
+    std::atomic<size_t> peak{0};
+    std::atomic<size_t> count{0};
+
+public:
+    void add(size_t bytes)
+    {
+        size_t now = live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t previous = peak.load(std::memory_order_relaxed);
+        while (now > previous && !peak.compare_exchange_weak(previous, now, std::memory_order_relaxed))
+        {
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void remove(size_t bytes) { live.fetch_sub(bytes, std::memory_order_relaxed); }
+
+    size_t liveBytes() const { return live.load(std::memory_order_relaxed); }
+    size_t peakBytes() const { return peak.load(std::memory_order_relaxed); }
+    size_t allocations() const { return count.load(std::memory_order_relaxed); }
+};
+
+/**
+ * Alocador para contêineres da STL que atribui as alocações a um contador
+ * (ex.: nós da std::list, blocos da std::deque, folga de capacidade do vetor)
+ * Contabiliza os bytes pedidos; a memória vem do operator new global
+ */
+template <typename T>
+class CountingAllocator
+{
+public:
+    using value_type = T;
+
+    AllocationCounter *counter;
+
+    explicit CountingAllocator(AllocationCounter *target) noexcept : counter(target) {}
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &other) noexcept : counter(other.counter) {}
+
+    T *allocate(size_t n)
+    {
+        T *memory = static_cast<T *>(::operator new(n * sizeof(T)));
+        counter->add(n * sizeof(T));
+        return memory;
+    }
+
+    void deallocate(T *memory, size_t n) noexcept
+    {
+        counter->remove(n * sizeof(T));
+        ::operator delete(memory);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U> &other) const noexcept { return counter == other.counter; }
+
+    template <typename U>
+    bool operator!=(const CountingAllocator<U> &other) const noexcept { return counter != other.counter; }
+};
+
+#endif // ALLOCATIONTRACKER_HPP
@@ -0,0 +1,417 @@
+#include "AsyncFileReader.hpp"
+#include "BlockPipeline.hpp"
+#include "InputSource.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#endif
+
+namespace
+{
+    constexpr size_t IO_ALIGNMENT = 4096;
+}
+
+AsyncFileReader::AsyncFileReader(int fileDescriptor, size_t blockBytes, size_t numBlocks)
+    : fd(fileDescriptor), ringFd(-1), blockSize(blockBytes), slots(numBlocks),
+      iovecArray(nullptr), sqRing(nullptr), cqRing(nullptr), sqes(nullptr),
+      sqRingSize(0), cqRingSize(0), sqesSize(0),
+      sqHead(nullptr), sqTail(nullptr), sqMask(nullptr), sqArray(nullptr),
+      cqHead(nullptr), cqTail(nullptr), cqMask(nullptr), cqes(nullptr),
+      nextOffset(0), fileSize(LLONG_MAX), consumeIndex(0), inFlight(0), hasCurrent(false), endReached(false)
+{
+    for (auto &slot : slots)
+    {
+        slot.buffer = static_cast<char *>(std::aligned_alloc(IO_ALIGNMENT, blockSize));
+        slot.offset = 0;
+        slot.filled = 0;
+        slot.state = SlotState::Idle;
+        slot.result = 0;
+        if (slot.buffer == nullptr)
+        {
+            release();
+            throw std::bad_alloc();
+        }
+    }
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+    stop();
+    release();
+}
+
+std::unique_ptr<BlockReader> AsyncFileReader::open(const std::string &filename, bool directIO,
+                                                   size_t blockSize, size_t numBlocks)
+{
+    blockSize = ((blockSize + IO_ALIGNMENT - 1) / IO_ALIGNMENT) * IO_ALIGNMENT;
+    numBlocks = std::max<size_t>(numBlocks, 2);
+
+#ifdef __linux__
+    int fileDescriptor = -1;
+    if (directIO)
+    {
+        // Alguns sistemas de arquivos (ex.: tmpfs) recusam O_DIRECT
+        fileDescriptor = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+    }
+    if (fileDescriptor < 0)
+    {
+        fileDescriptor = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Não foi possível abrir o arquivo " + filename);
+    }
+
+    std::unique_ptr<AsyncFileReader> reader(new AsyncFileReader(fileDescriptor, blockSize, numBlocks));
+    struct stat info;
+    if (fstat(fileDescriptor, &info) == 0 && S_ISREG(info.st_mode))
+    {
+        reader->fileSize = static_cast<long long>(info.st_size);
+    }
+    if (reader->setupRing(static_cast<unsigned>(numBlocks)))
+    {
+        for (size_t i = 0; i < numBlocks && !reader->failed(); ++i)
+        {
+            reader->queueRead(i);
+        }
+        return reader;
+    }
+#else
+    (void)directIO;
+#endif
+
+    // Sem io_uring: leitura sequencial numa thread auxiliar
+    return std::make_unique<BlockPipeline>(createInputSource(filename), blockSize, numBlocks);
+}
+
+bool AsyncFileReader::next(const char *&data, size_t &size)
+{
+    if (hasCurrent)
+    {
+        // Bloco devolvido pelo parser volta para a fila de leitura
+        hasCurrent = false;
+        slots[consumeIndex].state = SlotState::Idle;
+        if (!endReached)
+        {
+            queueRead(consumeIndex);
+        }
+        consumeIndex = (consumeIndex + 1) % slots.size();
+    }
+
+    Slot &slot = slots[consumeIndex];
+
+    while (true)
+    {
+        while (slot.state == SlotState::InFlight)
+        {
+            if (!submitAndWait(0, 1))
+            {
+                return false;
+            }
+            reapCompletions();
+        }
+
+        if (slot.state == SlotState::Idle)
+        {
+            return false;
+        }
+
+        if (slot.result < 0)
+        {
+            errorMessage = std::string("Erro de leitura assíncrona: ") + std::strerror(static_cast<int>(-slot.result));
+            slot.state = SlotState::Idle;
+            endReached = true;
+            return false;
+        }
+
+        slot.filled += static_cast<size_t>(slot.result);
+
+        // Leitura curta antes do fim do arquivo (ex.: sinal): pede o restante do bloco
+        if (slot.result > 0 && slot.filled < blockSize &&
+            slot.offset + static_cast<long long>(slot.filled) < fileSize)
+        {
+            submitRead(consumeIndex);
+            if (failed())
+            {
+                return false;
+            }
+            continue;
+        }
+        break;
+    }
+
+    if (slot.filled == 0)
+    {
+        slot.state = SlotState::Idle;
+        endReached = true;
+        return false;
+    }
+
+    // Fim só com leitura 0 ou ao alcançar o tamanho do arquivo
+    if (slot.filled < blockSize || slot.offset + static_cast<long long>(slot.filled) >= fileSize)
+    {
+        endReached = true;
+    }
+
+    hasCurrent = true;
+    data = slot.buffer;
+    size = slot.filled;
+    return true;
+}
+
+void AsyncFileReader::stop()
+{
+    endReached = true;
+
+    // Buffers só podem ser liberados após todas as leituras em voo terminarem
+    while (inFlight > 0 && ringFd >= 0)
+    {
+        if (!submitAndWait(0, static_cast<unsigned>(inFlight)))
+        {
+            break;
+        }
+        reapCompletions();
+    }
+}
+
+bool AsyncFileReader::failed() const
+{
+    return !errorMessage.empty();
+}
+
+const std::string &AsyncFileReader::getError() const
+{
+    return errorMessage;
+}
+
+#ifdef __linux__
+
+bool AsyncFileReader::setupRing(unsigned entries)
+{
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    ringFd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ringFd < 0)
+    {
+        return false;
+    }
+
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap)
+    {
+        sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+    }
+
+    sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                  ringFd, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED)
+    {
+        sqRing = nullptr;
+        return false;
+    }
+
+    if (singleMmap)
+    {
+        cqRing = sqRing;
+    }
+    else
+    {
+        cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED)
+        {
+            cqRing = nullptr;
+            return false;
+        }
+    }
+
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        sqes = nullptr;
+        return false;
+    }
+
+    char *sqBase = static_cast<char *>(sqRing);
+    sqHead = reinterpret_cast<unsigned *>(sqBase + params.sq_off.head);
+    sqTail = reinterpret_cast<unsigned *>(sqBase + params.sq_off.tail);
+    sqMask = reinterpret_cast<unsigned *>(sqBase + params.sq_off.ring_mask);
+    sqArray = reinterpret_cast<unsigned *>(sqBase + params.sq_off.array);
+
+    char *cqBase = static_cast<char *>(cqRing);
+    cqHead = reinterpret_cast<unsigned *>(cqBase + params.cq_off.head);
+    cqTail = reinterpret_cast<unsigned *>(cqBase + params.cq_off.tail);
+    cqMask = reinterpret_cast<unsigned *>(cqBase + params.cq_off.ring_mask);
+    cqes = cqBase + params.cq_off.cqes;
+
+    iovecArray = new iovec[slots.size()];
+    return true;
+}
+
+void AsyncFileReader::queueRead(size_t index)
+{
+    Slot &slot = slots[index];
+    slot.offset = nextOffset;
+    slot.filled = 0;
+    nextOffset += static_cast<long long>(blockSize);
+    submitRead(index);
+}
+
+void AsyncFileReader::submitRead(size_t index)
+{
+    Slot &slot = slots[index];
+    iovec *iov = static_cast<iovec *>(iovecArray) + index;
+    iov->iov_base = slot.buffer + slot.filled;
+    iov->iov_len = blockSize - slot.filled;
+
+    // Apenas esta thread escreve no tail da fila de submissão
+    unsigned tail = *sqTail;
+    unsigned sqIndex = tail & *sqMask;
+    io_uring_sqe *sqe = static_cast<io_uring_sqe *>(sqes) + sqIndex;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->off = static_cast<__u64>(slot.offset + static_cast<long long>(slot.filled));
+    sqe->addr = reinterpret_cast<__u64>(iov);
+    sqe->len = 1;
+    sqe->user_data = index;
+
+    sqArray[sqIndex] = sqIndex;
+    __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+
+    slot.state = SlotState::InFlight;
+    inFlight++;
+
+    if (!submitAndWait(1, 0))
+    {
+        // A SQE não foi consumida pelo kernel; não há leitura em voo
+        slot.state = SlotState::Idle;
+        inFlight--;
+        endReached = true;
+    }
+}
+
+bool AsyncFileReader::submitAndWait(unsigned toSubmit, unsigned minComplete)
+{
+    unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (true)
+    {
+        long ret = syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0);
+        if (ret >= 0)
+        {
+            return true;
+        }
+        if (errno != EINTR)
+        {
+            errorMessage = std::string("io_uring_enter falhou: ") + std::strerror(errno);
+            return false;
+        }
+    }
+}
+
+void AsyncFileReader::reapCompletions()
+{
+    unsigned head = *cqHead;
+    unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+
+    while (head != tail)
+    {
+        const io_uring_cqe *cqe = static_cast<const io_uring_cqe *>(cqes) + (head & *cqMask);
+        Slot &slot = slots[static_cast<size_t>(cqe->user_data)];
+        slot.result = cqe->res;
+        slot.state = SlotState::Ready;
+        inFlight--;
+        head++;
+    }
+
+    __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+}
+
+void AsyncFileReader::release()
+{
+    if (sqes != nullptr)
+    {
+        munmap(sqes, sqesSize);
+    }
+    if (cqRing != nullptr && cqRing != sqRing)
+    {
+        munmap(cqRing, cqRingSize);
+    }
+    if (sqRing != nullptr)
+    {
+        munmap(sqRing, sqRingSize);
+    }
+    sqes = cqRing = sqRing = nullptr;
+
+    if (ringFd >= 0)
+    {
+        ::close(ringFd);
+        ringFd = -1;
+    }
+    if (fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+
+    delete[] static_cast<iovec *>(iovecArray);
+    iovecArray = nullptr;
+
+    for (auto &slot : slots)
+    {
+        std::free(slot.buffer);
+        slot.buffer = nullptr;
+    }
+}
+
+#else
+
+bool AsyncFileReader::setupRing(unsigned)
+{
+    return false;
+}
+
+void AsyncFileReader::queueRead(size_t)
+{
+}
+
+void AsyncFileReader::submitRead(size_t)
+{
+}
+
+bool AsyncFileReader::submitAndWait(unsigned, unsigned)
+{
+    return false;
+}
+
+void AsyncFileReader::reapCompletions()
+{
+}
+
+void AsyncFileReader::release()
+{
+    for (auto &slot : slots)
+    {
+        std::free(slot.buffer);
+        slot.buffer = nullptr;
+    }
+}
+
+#endif
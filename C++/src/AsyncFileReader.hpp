@@ -0,0 +1,100 @@
+#ifndef ASYNCFILEREADER_HPP
+#define ASYNCFILEREADER_HPP
+
+#include "BlockReader.hpp"
+#include <vector>
+#include <string>
+#include <memory>
+
+/**
+ * Leitor assíncrono de arquivo para Linux baseado em io_uring
+ * Mantém vários blocos alinhados em voo (opcionalmente com O_DIRECT)
+ * e entrega ao parser cada bloco concluído, na ordem do arquivo.
+ * Sem io_uring disponível, open() recai em pread numa thread auxiliar
+ * (BlockPipeline sobre o arquivo simples).
+ */
+class AsyncFileReader : public BlockReader
+{
+private:
+    enum class SlotState
+    {
+        Idle,
+        InFlight,
+        Ready
+    };
+
+    struct Slot
+    {
+        char *buffer;
+        long long offset;
+        size_t filled; // Bytes já lidos no bloco (leituras curtas são completadas)
+        SlotState state;
+        long long result;
+    };
+
+    int fd;
+    int ringFd;
+    size_t blockSize;
+    std::vector<Slot> slots;
+    void *iovecArray; // struct iovec por slot (READV)
+
+    // Anéis mapeados do io_uring
+    void *sqRing;
+    void *cqRing;
+    void *sqes;
+    size_t sqRingSize;
+    size_t cqRingSize;
+    size_t sqesSize;
+    unsigned *sqHead;
+    unsigned *sqTail;
+    unsigned *sqMask;
+    unsigned *sqArray;
+    unsigned *cqHead;
+    unsigned *cqTail;
+    unsigned *cqMask;
+    void *cqes;
+
+    long long nextOffset;
+    long long fileSize; // fstat na abertura; só ele (ou leitura 0) indica o fim
+    size_t consumeIndex;
+    size_t inFlight;
+    bool hasCurrent;
+    bool endReached;
+    std::string errorMessage;
+
+    AsyncFileReader(int fileDescriptor, size_t blockBytes, size_t numBlocks);
+
+public:
+    /**
+     * Abre o arquivo com o melhor leitor disponível
+     * @param filename Caminho do arquivo (não comprimido)
+     * @param directIO Usa O_DIRECT quando o sistema de arquivos permitir
+     * @param blockSize Tamanho de cada bloco (múltiplo de 4096)
+     * @param numBlocks Número de leituras mantidas em voo
+     * @return Leitor io_uring ou, na falta dele, BlockPipeline com pread
+     */
+    static std::unique_ptr<BlockReader> open(const std::string &filename,
+                                             bool directIO = true,
+                                             size_t blockSize = 1 << 20,
+                                             size_t numBlocks = 8);
+
+    ~AsyncFileReader() override;
+
+    AsyncFileReader(const AsyncFileReader &) = delete;
+    AsyncFileReader &operator=(const AsyncFileReader &) = delete;
+
+    bool next(const char *&data, size_t &size) override;
+    void stop() override;
+    bool failed() const override;
+    const std::string &getError() const override;
+
+private:
+    bool setupRing(unsigned entries);
+    void queueRead(size_t index);
+    void submitRead(size_t index);
+    bool submitAndWait(unsigned toSubmit, unsigned minComplete);
+    void reapCompletions();
+    void release();
+};
+
+#endif // ASYNCFILEREADER_HPP
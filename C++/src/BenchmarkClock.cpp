@@ -0,0 +1,103 @@
+#include "BenchmarkClock.hpp"
+#include <algorithm>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace
+{
+    constexpr int OVERHEAD_SAMPLES = 1001;
+    constexpr std::chrono::milliseconds CALIBRATION_TIME(20);
+
+    // TSC com frequência constante e que não para em estados de economia
+    bool hasInvariantTSC()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007)
+        {
+            return false;
+        }
+        __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+        return (edx & (1u << 8)) != 0;
+#else
+        return false;
+#endif
+    }
+}
+
+bool BenchmarkClock::enableTSC()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (!hasInvariantTSC())
+    {
+        return false;
+    }
+
+    // Espera ativa: o intervalo de referência vem do steady_clock
+    auto startSteady = std::chrono::steady_clock::now();
+    uint64_t startTicks = __rdtsc();
+    auto endSteady = startSteady;
+    while (endSteady - startSteady < CALIBRATION_TIME)
+    {
+        endSteady = std::chrono::steady_clock::now();
+    }
+    uint64_t endTicks = __rdtsc();
+
+    if (endTicks <= startTicks)
+    {
+        return false;
+    }
+    double nanoseconds = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(endSteady - startSteady).count());
+    nanosecondsPerTick = nanoseconds / static_cast<double>(endTicks - startTicks);
+    activeSource = Source::TSC;
+    measureOverhead();
+    return true;
+#else
+    return false;
+#endif
+}
+
+void BenchmarkClock::useSteady()
+{
+    activeSource = Source::Steady;
+    nanosecondsPerTick = 1.0;
+    measureOverhead();
+}
+
+const char *BenchmarkClock::sourceName()
+{
+    return activeSource == Source::TSC ? "TSC (rdtsc calibrado)" : "steady_clock";
+}
+
+double BenchmarkClock::ticksPerSecond()
+{
+    return activeSource == Source::TSC ? 1000000000.0 / nanosecondsPerTick : 0.0;
+}
+
+void BenchmarkClock::measureOverhead()
+{
+    std::vector<int64_t> samples(OVERHEAD_SAMPLES);
+    for (int i = 0; i < OVERHEAD_SAMPLES; ++i)
+    {
+        uint64_t start = now();
+        uint64_t end = now();
+        samples[i] = elapsed(start, end).count();
+    }
+    std::nth_element(samples.begin(), samples.begin() + OVERHEAD_SAMPLES / 2, samples.end());
+    measuredOverhead = std::chrono::nanoseconds(samples[OVERHEAD_SAMPLES / 2]);
+    overheadMeasured = true;
+}
+
+std::chrono::nanoseconds BenchmarkClock::overhead()
+{
+    // steady_clock é a fonte inicial e ainda não foi medido
+    if (!overheadMeasured)
+    {
+        measureOverhead();
+    }
+    return measuredOverhead;
+}
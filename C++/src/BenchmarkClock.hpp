@@ -0,0 +1,93 @@
+#ifndef BENCHMARKCLOCK_HPP
+#define BENCHMARKCLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * Relógio das fases do benchmark, em nanossegundos
+ * Por padrão usa std::chrono::steady_clock; enableTSC() troca para o
+ * contador de ciclos (rdtsc) calibrado contra o steady_clock, quando a CPU
+ * anuncia TSC invariante. O custo de uma leitura dupla do relógio é medido
+ * a cada troca de fonte (overhead) para ser reportado junto dos tempos.
+ */
+class BenchmarkClock
+{
+public:
+    enum class Source
+    {
+        Steady,
+        TSC
+    };
+
+private:
+    static inline Source activeSource = Source::Steady;
+    static inline double nanosecondsPerTick = 1.0;
+    static inline std::chrono::nanoseconds measuredOverhead{0};
+    static inline bool overheadMeasured = false;
+
+public:
+    /**
+     * Leitura da fonte ativa, em ticks (ns no steady_clock, ciclos no TSC)
+     */
+    static uint64_t now()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        if (activeSource == Source::TSC)
+        {
+            // lfence impede que a leitura seja adiantada para antes do código medido
+            _mm_lfence();
+            uint64_t ticks = __rdtsc();
+            _mm_lfence();
+            return ticks;
+        }
+#endif
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    /**
+     * Converte o intervalo entre duas leituras de now() em nanossegundos
+     */
+    static std::chrono::nanoseconds elapsed(uint64_t start, uint64_t end)
+    {
+        uint64_t ticks = end > start ? end - start : 0;
+        if (activeSource == Source::Steady)
+        {
+            return std::chrono::nanoseconds(static_cast<int64_t>(ticks));
+        }
+        return std::chrono::nanoseconds(static_cast<int64_t>(ticks * nanosecondsPerTick + 0.5));
+    }
+
+    /**
+     * Passa a usar o TSC, calibrado contra o steady_clock
+     * @return false (e mantém o steady_clock) se não houver TSC invariante
+     */
+    static bool enableTSC();
+
+    /**
+     * Volta para o steady_clock
+     */
+    static void useSteady();
+
+    static Source source() { return activeSource; }
+    static const char *sourceName();
+
+    // Frequência do TSC calibrada (0 no steady_clock)
+    static double ticksPerSecond();
+
+    /**
+     * Custo de duas leituras consecutivas (mediana), já em nanossegundos
+     */
+    static std::chrono::nanoseconds overhead();
+
+private:
+    static void measureOverhead();
+};
+
+#endif // BENCHMARKCLOCK_HPP
@@ -0,0 +1,20 @@
+#include "BenchmarkContext.hpp"
+#include <algorithm>
+
+BenchmarkContext::BenchmarkContext(size_t capacity) : completedRuns(0)
+{
+    reserve(capacity);
+}
+
+void BenchmarkContext::reserve(size_t capacity)
+{
+    inputBuffer.reserve(capacity);
+    convertedBuffer.reserve(capacity);
+    outputBuffer.reserve(capacity);
+}
+
+const std::vector<int> &BenchmarkContext::loadInput(const std::vector<int> &ratings, size_t dataSize)
+{
+    inputBuffer.assign(ratings.begin(), ratings.begin() + std::min(dataSize, ratings.size()));
+    return inputBuffer;
+}
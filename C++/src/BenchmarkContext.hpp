@@ -0,0 +1,59 @@
+#ifndef BENCHMARKCONTEXT_HPP
+#define BENCHMARKCONTEXT_HPP
+
+#include "CompressedSortedSequence.hpp"
+#include <vector>
+#include <cstddef>
+
+/**
+ * Buffers reaproveitados entre as repetições de um mesmo teste
+ * Entrada, cópia da estrutura (toVector), histograma (scratch), saída
+ * ordenada e sequência compactada são reservados uma vez e apenas
+ * esvaziados a cada repetição: a primeira execução paga o primeiro toque
+ * nas páginas (fria) e as seguintes medem só o trabalho do algoritmo (quentes)
+ */
+class BenchmarkContext
+{
+private:
+    std::vector<int> inputBuffer;
+    std::vector<int> convertedBuffer;
+    std::vector<size_t> scratchBuffer;
+    std::vector<int> outputBuffer;
+    CompressedSortedSequence compressedBuffer;
+    size_t completedRuns;
+
+public:
+    /**
+     * @param capacity Quantidade de elementos reservada nos buffers
+     */
+    explicit BenchmarkContext(size_t capacity = 0);
+
+    /**
+     * Garante capacidade para capacity elementos sem realocar depois
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Copia os primeiros dataSize valores para o buffer de entrada,
+     * reaproveitando a capacidade já alocada
+     * @return Buffer de entrada preenchido
+     */
+    const std::vector<int> &loadInput(const std::vector<int> &ratings, size_t dataSize);
+
+    const std::vector<int> &input() const { return inputBuffer; }
+    std::vector<int> &converted() { return convertedBuffer; }
+    std::vector<size_t> &scratch() { return scratchBuffer; }
+    std::vector<int> &output() { return outputBuffer; }
+    CompressedSortedSequence &compressed() { return compressedBuffer; }
+
+    /**
+     * Registra o fim de uma repetição; as próximas passam a ser quentes
+     */
+    void finishRun() { completedRuns++; }
+
+    // true depois da primeira repetição concluída
+    bool isWarm() const { return completedRuns > 0; }
+    size_t runs() const { return completedRuns; }
+};
+
+#endif // BENCHMARKCONTEXT_HPP
@@ -0,0 +1,133 @@
+#include "BenchmarkStatistics.hpp"
+#include <algorithm>
+#include <cmath>
+
+BenchmarkStatistics::BenchmarkStatistics(const Config &configuration)
+    : config(configuration), warmupSeen(0)
+{
+    config.minSamples = std::max<size_t>(config.minSamples, 1);
+    config.maxSamples = std::max(config.maxSamples, config.minSamples);
+    values.reserve(config.maxSamples);
+}
+
+void BenchmarkStatistics::add(double value)
+{
+    if (warmupSeen < config.warmup)
+    {
+        warmupSeen++;
+        return;
+    }
+    values.push_back(value);
+}
+
+bool BenchmarkStatistics::warmingUp() const
+{
+    return warmupSeen < config.warmup;
+}
+
+bool BenchmarkStatistics::done() const
+{
+    if (values.size() >= config.maxSamples)
+    {
+        return true;
+    }
+    return !warmingUp() && summarize().converged;
+}
+
+BenchmarkStatistics::Summary BenchmarkStatistics::summarize() const
+{
+    return summarize(values, config.targetRelativeCI, config.minSamples);
+}
+
+BenchmarkStatistics::Summary BenchmarkStatistics::summarize(const std::vector<double> &samples,
+                                                            double targetRelativeCI, size_t minSamples)
+{
+    Summary summary = {};
+    summary.samples = samples.size();
+    if (samples.empty())
+    {
+        return summary;
+    }
+
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (double value : sorted)
+    {
+        sum += value;
+    }
+    summary.mean = sum / sorted.size();
+    summary.min = sorted.front();
+    summary.max = sorted.back();
+    summary.median = percentile(sorted, 0.5);
+    summary.p90 = percentile(sorted, 0.9);
+    summary.p99 = percentile(sorted, 0.99);
+
+    if (sorted.size() > 1)
+    {
+        double squares = 0.0;
+        for (double value : sorted)
+        {
+            squares += (value - summary.mean) * (value - summary.mean);
+        }
+        summary.stddev = std::sqrt(squares / (sorted.size() - 1));
+        summary.ciHalfWidth = studentT95(sorted.size() - 1) * summary.stddev / std::sqrt(static_cast<double>(sorted.size()));
+    }
+    summary.relativeCI = summary.mean > 0.0 ? summary.ciHalfWidth / summary.mean : 0.0;
+
+    // Cercas de Tukey; com poucas amostras o IQR não é confiável
+    if (sorted.size() >= 4)
+    {
+        double q1 = percentile(sorted, 0.25);
+        double q3 = percentile(sorted, 0.75);
+        double fence = 1.5 * (q3 - q1);
+        for (double value : sorted)
+        {
+            if (value < q1 - fence || value > q3 + fence)
+            {
+                summary.outliers++;
+            }
+        }
+    }
+
+    summary.converged = sorted.size() >= std::max<size_t>(minSamples, 2) && summary.relativeCI <= targetRelativeCI;
+    return summary;
+}
+
+double BenchmarkStatistics::percentile(const std::vector<double> &sorted, double fraction)
+{
+    double position = fraction * (sorted.size() - 1);
+    size_t lower = static_cast<size_t>(position);
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    double weight = position - lower;
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * weight;
+}
+
+double BenchmarkStatistics::studentT95(size_t degrees)
+{
+    static const double TABLE[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    const size_t TABLE_SIZE = sizeof(TABLE) / sizeof(TABLE[0]);
+
+    if (degrees == 0)
+    {
+        return 0.0;
+    }
+    if (degrees <= TABLE_SIZE)
+    {
+        return TABLE[degrees - 1];
+    }
+    // Faixas conservadoras: cada uma usa o quantil do seu limite inferior
+    if (degrees <= 40)
+    {
+        return 2.042;
+    }
+    if (degrees <= 60)
+    {
+        return 2.021;
+    }
+    return degrees <= 120 ? 2.000 : 1.980;
+}
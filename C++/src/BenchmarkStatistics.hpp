@@ -0,0 +1,84 @@
+#ifndef BENCHMARKSTATISTICS_HPP
+#define BENCHMARKSTATISTICS_HPP
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * Coleta adaptativa de amostras de tempo de um teste
+ * As primeiras execuções (aquecimento) são descartadas; depois as amostras
+ * são acumuladas até o intervalo de confiança de 95% da média ficar abaixo
+ * da fração alvo da média, respeitando os limites mínimo e máximo
+ */
+class BenchmarkStatistics
+{
+public:
+    struct Config
+    {
+        size_t warmup = 2;              // Execuções descartadas antes das amostras
+        size_t minSamples = 5;
+        size_t maxSamples = 50;
+        double targetRelativeCI = 0.05; // Meia largura do IC 95% / média
+    };
+
+    struct Summary
+    {
+        size_t samples;
+        double mean;
+        double min;
+        double median;
+        double p90;
+        double p99;
+        double max;
+        double stddev;      // Desvio padrão amostral
+        double ciHalfWidth; // Meia largura do IC 95% da média (t de Student)
+        double relativeCI;  // ciHalfWidth / mean (0 quando a média é 0)
+        size_t outliers;    // Fora das cercas de Tukey (1,5 × IQR)
+        bool converged;     // relativeCI atingiu o alvo com amostras suficientes
+    };
+
+private:
+    Config config;
+    size_t warmupSeen;
+    std::vector<double> values;
+
+public:
+    explicit BenchmarkStatistics(const Config &configuration);
+
+    /**
+     * Registra o tempo de uma execução; durante o aquecimento é descartado
+     * @param value Tempo medido (qualquer unidade, consistente entre chamadas)
+     */
+    void add(double value);
+
+    // true enquanto as execuções ainda são descartadas como aquecimento
+    bool warmingUp() const;
+
+    /**
+     * Indica que não é preciso medir mais: IC alvo atingido ou maxSamples coletadas
+     */
+    bool done() const;
+
+    Summary summarize() const;
+
+    /**
+     * Resume um conjunto de amostras
+     * @param samples Amostras em qualquer ordem
+     * @param targetRelativeCI Alvo usado para preencher converged
+     * @param minSamples Mínimo de amostras para considerar convergido
+     */
+    static Summary summarize(const std::vector<double> &samples, double targetRelativeCI, size_t minSamples);
+
+    /**
+     * Percentil com interpolação linear entre vizinhos
+     * @param sorted Amostras em ordem crescente (não vazio)
+     * @param fraction Posição entre 0 e 1
+     */
+    static double percentile(const std::vector<double> &sorted, double fraction);
+
+private:
+    // Quantil bicaudal de 95% da t de Student com degrees graus de liberdade
+    static double studentT95(size_t degrees);
+};
+
+#endif // BENCHMARKSTATISTICS_HPP
@@ -0,0 +1,133 @@
+#include "BlockPipeline.hpp"
+#include <algorithm>
+#include <exception>
+
+BlockPipeline::BlockPipeline(std::unique_ptr<InputSource> input, size_t blockSize, size_t numBlocks)
+    : source(std::move(input)), currentBlock(0), hasCurrentBlock(false),
+      finished(false), stopRequested(false)
+{
+    numBlocks = std::max<size_t>(numBlocks, 2);
+    blocks.resize(numBlocks);
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+        blocks[i].resize(blockSize);
+        freeBlocks.push_back(i);
+    }
+
+    producer = std::thread(&BlockPipeline::produce, this);
+}
+
+BlockPipeline::~BlockPipeline()
+{
+    stop();
+}
+
+void BlockPipeline::produce()
+{
+    while (true)
+    {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            blockFreed.wait(lock, [this]()
+                            { return stopRequested || !freeBlocks.empty(); });
+            if (stopRequested)
+            {
+                break;
+            }
+            index = freeBlocks.front();
+            freeBlocks.pop_front();
+        }
+
+        size_t bytes = 0;
+        try
+        {
+            // Preenche o bloco inteiro para que o parser receba blocos grandes
+            std::vector<char> &block = blocks[index];
+            while (bytes < block.size())
+            {
+                size_t got = source->read(block.data() + bytes, block.size() - bytes);
+                if (got == 0)
+                {
+                    break;
+                }
+                bytes += got;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            errorMessage = e.what();
+            finished = true;
+            blockFilled.notify_one();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (bytes == 0)
+        {
+            finished = true;
+            blockFilled.notify_one();
+            return;
+        }
+        filledBlocks.push_back({index, bytes});
+        blockFilled.notify_one();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+    blockFilled.notify_one();
+}
+
+bool BlockPipeline::next(const char *&data, size_t &size)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (hasCurrentBlock)
+    {
+        freeBlocks.push_back(currentBlock);
+        hasCurrentBlock = false;
+        blockFreed.notify_one();
+    }
+
+    blockFilled.wait(lock, [this]()
+                     { return finished || !filledBlocks.empty(); });
+
+    if (filledBlocks.empty())
+    {
+        return false;
+    }
+
+    FilledBlock filled = filledBlocks.front();
+    filledBlocks.pop_front();
+    currentBlock = filled.index;
+    hasCurrentBlock = true;
+
+    data = blocks[filled.index].data();
+    size = filled.size;
+    return true;
+}
+
+void BlockPipeline::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+        blockFreed.notify_one();
+    }
+
+    if (producer.joinable())
+    {
+        producer.join();
+    }
+}
+
+bool BlockPipeline::failed() const
+{
+    return !errorMessage.empty();
+}
+
+const std::string &BlockPipeline::getError() const
+{
+    return errorMessage;
+}
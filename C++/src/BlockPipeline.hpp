@@ -0,0 +1,78 @@
+#ifndef BLOCKPIPELINE_HPP
+#define BLOCKPIPELINE_HPP
+
+#include "BlockReader.hpp"
+#include "InputSource.hpp"
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * Leitura em blocos com produtor dedicado
+ * Uma thread lê/descomprime a InputSource em blocos reutilizáveis
+ * enquanto a thread chamadora faz o parsing do bloco anterior
+ */
+class BlockPipeline : public BlockReader
+{
+private:
+    struct FilledBlock
+    {
+        size_t index;
+        size_t size;
+    };
+
+    std::unique_ptr<InputSource> source;
+    std::vector<std::vector<char>> blocks;
+    std::deque<size_t> freeBlocks;
+    std::deque<FilledBlock> filledBlocks;
+    size_t currentBlock;
+    bool hasCurrentBlock;
+    bool finished;
+    bool stopRequested;
+    std::string errorMessage;
+
+    std::mutex mutex;
+    std::condition_variable blockFreed;
+    std::condition_variable blockFilled;
+    std::thread producer;
+
+public:
+    /**
+     * @param input Fonte dos bytes (arquivo simples ou comprimido)
+     * @param blockSize Tamanho de cada bloco em bytes
+     * @param numBlocks Número de blocos em circulação (mínimo 2)
+     */
+    explicit BlockPipeline(std::unique_ptr<InputSource> input,
+                           size_t blockSize = 4 << 20,
+                           size_t numBlocks = 3);
+    ~BlockPipeline() override;
+
+    BlockPipeline(const BlockPipeline &) = delete;
+    BlockPipeline &operator=(const BlockPipeline &) = delete;
+
+    /**
+     * Obtém o próximo bloco preenchido
+     * O bloco anterior é devolvido ao produtor nesta chamada
+     * @param data Recebe o início do bloco
+     * @param size Recebe o número de bytes válidos
+     * @return false quando não há mais dados
+     */
+    bool next(const char *&data, size_t &size) override;
+
+    /**
+     * Interrompe o produtor (ex.: limite de registros atingido)
+     */
+    void stop() override;
+
+    bool failed() const override;
+    const std::string &getError() const override;
+
+private:
+    void produce();
+};
+
+#endif // BLOCKPIPELINE_HPP
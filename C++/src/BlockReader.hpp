@@ -0,0 +1,33 @@
+#ifndef BLOCKREADER_HPP
+#define BLOCKREADER_HPP
+
+#include <string>
+#include <cstddef>
+
+/**
+ * Interface comum para leitores que entregam blocos prontos ao parser
+ * O bloco devolvido por next() permanece válido até a próxima chamada
+ */
+class BlockReader
+{
+public:
+    virtual ~BlockReader() = default;
+
+    /**
+     * Obtém o próximo bloco em ordem de arquivo
+     * @param data Recebe o início do bloco
+     * @param size Recebe o número de bytes válidos
+     * @return false quando não há mais dados
+     */
+    virtual bool next(const char *&data, size_t &size) = 0;
+
+    /**
+     * Interrompe leituras pendentes (ex.: limite de registros atingido)
+     */
+    virtual void stop() = 0;
+
+    virtual bool failed() const = 0;
+    virtual const std::string &getError() const = 0;
+};
+
+#endif // BLOCKREADER_HPP
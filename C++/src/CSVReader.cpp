@@ -1,51 +1,327 @@
 #include "CSVReader.hpp"
+#include "AsyncFileReader.hpp"
+#include "BlockPipeline.hpp"
+#include "InputSource.hpp"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <charconv>
+#include <cstring>
 
-CSVReader::CSVReader(const std::string &file) : filename(file) {}
+CSVReader::CSVReader(const std::string &file)
+    : filename(file), parseMode(ParseMode::Fast), ioMode(IOMode::Buffered),
+      samplingMode(RecordSampler::Mode::Head), samplingSeed(42), maxErrorSamples(10) {}
 
 std::vector<int> CSVReader::readMovieIds(size_t maxRecords)
 {
     std::vector<int> movieIds;
-    std::ifstream file(filename);
+    lastStatistics.reset();
 
-    if (!file.is_open())
+    // Head encerra a leitura ao atingir maxRecords; os demais modos percorrem o arquivo todo
+    RecordSampler sampler(samplingMode, maxRecords, samplingSeed);
+
+    if (isCompressedFile(filename) || ioMode == IOMode::Async)
     {
-        std::cerr << "Erro: Não foi possível abrir o arquivo " << filename << std::endl;
-        return movieIds;
+        if (!readMovieIdsFromBlocks(sampler))
+        {
+            return movieIds;
+        }
     }
+    else
+    {
+        std::ifstream file(filename);
 
-    std::string line;
-    bool firstLine = true;
-    size_t recordCount = 0;
+        if (!file.is_open())
+        {
+            std::cerr << "Erro: Não foi possível abrir o arquivo " << filename << std::endl;
+            return movieIds;
+        }
+
+        std::string line;
+        size_t lineNumber = 0;
+
+        while (!sampler.done() && std::getline(file, line))
+        {
+            consumeLine(line.data(), line.data() + line.size(), ++lineNumber, sampler);
+        }
+
+        file.close();
+    }
+
+    lastStatistics.accepted = sampler.getSeen();
+    movieIds = sampler.finish();
 
-    while (std::getline(file, line) && (maxRecords == 0 || recordCount < maxRecords))
+    std::cout << "Lidos " << movieIds.size() << " movieIds do arquivo " << filename;
+    if (samplingMode != RecordSampler::Mode::Head && maxRecords != 0)
     {
-        // Pula o cabeçalho
-        if (firstLine)
+        std::cout << " (amostra " << RecordSampler::modeName(samplingMode)
+                  << " de " << lastStatistics.accepted << " registros)";
+    }
+    std::cout << std::endl;
+    if (lastStatistics.totalRejected() > 0)
+    {
+        printStatistics(std::cerr);
+    }
+    return movieIds;
+}
+
+bool CSVReader::readMovieIdsFromBlocks(RecordSampler &sampler)
+{
+    std::unique_ptr<BlockReader> reader;
+    try
+    {
+        // Descompressão na thread do pipeline; arquivo simples via io_uring
+        if (isCompressedFile(filename))
         {
-            firstLine = false;
-            continue;
+            reader = std::make_unique<BlockPipeline>(createInputSource(filename));
+        }
+        else
+        {
+            reader = AsyncFileReader::open(filename);
         }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << std::endl;
+        return false;
+    }
 
-        try
+    std::string carry; // Linha incompleta no fim do bloco anterior
+    size_t lineNumber = 0;
+    const char *data = nullptr;
+    size_t size = 0;
+
+    while (!sampler.done() && reader->next(data, size))
+    {
+        const char *cursor = data;
+        const char *end = data + size;
+
+        if (!carry.empty())
         {
-            int movieId = parseMovieId(line);
-            movieIds.push_back(movieId);
-            recordCount++;
+            const char *newline = static_cast<const char *>(std::memchr(cursor, '\n', end - cursor));
+            if (newline == nullptr)
+            {
+                carry.append(cursor, end);
+                continue;
+            }
+            carry.append(cursor, newline);
+            consumeLine(carry.data(), carry.data() + carry.size(), ++lineNumber, sampler);
+            carry.clear();
+            cursor = newline + 1;
         }
-        catch (const std::exception &e)
+
+        while (cursor < end && !sampler.done())
         {
-            std::cerr << "Erro ao processar linha: " << line << std::endl;
-            std::cerr << "Erro: " << e.what() << std::endl;
+            const char *newline = static_cast<const char *>(std::memchr(cursor, '\n', end - cursor));
+            if (newline == nullptr)
+            {
+                carry.assign(cursor, end);
+                break;
+            }
+            consumeLine(cursor, newline, ++lineNumber, sampler);
+            cursor = newline + 1;
         }
     }
 
-    file.close();
+    if (!carry.empty() && !sampler.done())
+    {
+        consumeLine(carry.data(), carry.data() + carry.size(), ++lineNumber, sampler);
+    }
 
-    std::cout << "Lidos " << movieIds.size() << " movieIds do arquivo " << filename << std::endl;
-    return movieIds;
+    reader->stop();
+    if (reader->failed())
+    {
+        // Erro no meio do arquivo: descarta a leitura parcial
+        std::cerr << "Erro: " << reader->getError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void CSVReader::consumeLine(const char *begin, const char *end, size_t lineNumber, RecordSampler &sampler)
+{
+    // Pula o cabeçalho
+    if (lineNumber == 1)
+    {
+        return;
+    }
+
+    lastStatistics.linesRead++;
+
+    if (parseMode == ParseMode::Fast)
+    {
+        int movieId = 0;
+        ParseError error = parseMovieIdFast(begin, end, movieId);
+        if (error == ParseError::None)
+        {
+            sampler.offer(movieId);
+        }
+        else
+        {
+            recordRejection(error, lineNumber);
+        }
+        return;
+    }
+
+    std::string line(begin, end);
+    try
+    {
+        sampler.offer(parseMovieId(line));
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro ao processar linha: " << line << std::endl;
+        std::cerr << "Erro: " << e.what() << std::endl;
+        int ignored = 0;
+        recordRejection(parseMovieIdFast(begin, end, ignored), lineNumber);
+    }
+}
+
+size_t CSVReader::ParseStatistics::totalRejected() const
+{
+    size_t total = 0;
+    for (size_t count : rejected)
+    {
+        total += count;
+    }
+    return total;
+}
+
+void CSVReader::ParseStatistics::reset()
+{
+    linesRead = 0;
+    accepted = 0;
+    rejected.fill(0);
+    sampleLines.clear();
+}
+
+void CSVReader::setParseMode(ParseMode mode)
+{
+    parseMode = mode;
+}
+
+void CSVReader::setIOMode(IOMode mode)
+{
+    ioMode = mode;
+}
+
+void CSVReader::setSampling(RecordSampler::Mode mode, uint64_t seed)
+{
+    samplingMode = mode;
+    samplingSeed = seed;
+}
+
+void CSVReader::setMaxErrorSamples(size_t maxSamples)
+{
+    maxErrorSamples = maxSamples;
+}
+
+const CSVReader::ParseStatistics &CSVReader::getStatistics() const
+{
+    return lastStatistics;
+}
+
+void CSVReader::recordRejection(ParseError error, size_t lineNumber)
+{
+    // Strict pode capturar exceções que o modo rápido aceitaria
+    if (error == ParseError::None)
+    {
+        error = ParseError::InvalidNumber;
+    }
+
+    lastStatistics.rejected[static_cast<size_t>(error)]++;
+    if (lastStatistics.sampleLines.size() < maxErrorSamples)
+    {
+        lastStatistics.sampleLines.push_back(lineNumber);
+    }
+}
+
+void CSVReader::printStatistics(std::ostream &os) const
+{
+    os << "Linhas rejeitadas: " << lastStatistics.totalRejected()
+       << " de " << lastStatistics.linesRead << '\n';
+
+    for (size_t i = 1; i < lastStatistics.rejected.size(); i++)
+    {
+        if (lastStatistics.rejected[i] > 0)
+        {
+            os << "  " << errorName(static_cast<ParseError>(i)) << ": "
+               << lastStatistics.rejected[i] << '\n';
+        }
+    }
+
+    if (!lastStatistics.sampleLines.empty())
+    {
+        os << "  Amostra de linhas:";
+        for (size_t lineNumber : lastStatistics.sampleLines)
+        {
+            os << ' ' << lineNumber;
+        }
+        os << '\n';
+    }
+    os.flush();
+}
+
+const char *CSVReader::errorName(ParseError error)
+{
+    switch (error)
+    {
+    case ParseError::None:
+        return "ok";
+    case ParseError::MissingField:
+        return "coluna ausente";
+    case ParseError::EmptyField:
+        return "movieId vazio";
+    case ParseError::InvalidNumber:
+        return "movieId não numérico";
+    case ParseError::OutOfRange:
+        return "movieId fora do intervalo";
+    default:
+        return "desconhecido";
+    }
+}
+
+CSVReader::ParseError CSVReader::parseMovieIdFast(const char *begin, const char *end, int &movieId) noexcept
+{
+    // userId,movieId,rating,timestamp -> campo entre a primeira e a segunda vírgula
+    const char *fieldBegin = static_cast<const char *>(std::memchr(begin, ',', end - begin));
+    if (fieldBegin == nullptr)
+    {
+        return ParseError::MissingField;
+    }
+    fieldBegin++;
+
+    const char *fieldEnd = static_cast<const char *>(std::memchr(fieldBegin, ',', end - fieldBegin));
+    if (fieldEnd == nullptr)
+    {
+        fieldEnd = end;
+    }
+
+    while (fieldBegin < fieldEnd && (*fieldBegin == ' ' || *fieldBegin == '"'))
+    {
+        fieldBegin++;
+    }
+    while (fieldEnd > fieldBegin && (fieldEnd[-1] == ' ' || fieldEnd[-1] == '"' || fieldEnd[-1] == '\r'))
+    {
+        fieldEnd--;
+    }
+
+    if (fieldBegin == fieldEnd)
+    {
+        return ParseError::EmptyField;
+    }
+
+    auto [ptr, ec] = std::from_chars(fieldBegin, fieldEnd, movieId);
+    if (ec == std::errc::result_out_of_range)
+    {
+        return ParseError::OutOfRange;
+    }
+    if (ec != std::errc() || ptr != fieldEnd)
+    {
+        return ParseError::InvalidNumber;
+    }
+
+    return ParseError::None;
 }
 
 bool CSVReader::isValidFile() const
@@ -4,22 +4,84 @@
 #include <vector>
 #include <string>
 #include <fstream>
+#include <array>
+#include <ostream>
+#include <cstdint>
+#include "RecordSampler.hpp"
 
 /**
  * Classe responsável por ler dados do arquivo CSV
  * Agora extrai movieIds do arquivo ratings.csv (userId,movieId,rating,timestamp)
+ * Arquivos .gz/.zst são descomprimidos em uma thread separada (ver InputSource)
  */
 class CSVReader
 {
+public:
+    /**
+     * Categorias de rejeição de linha no modo rápido
+     */
+    enum class ParseError
+    {
+        None = 0,
+        MissingField,  // Menos de duas colunas
+        EmptyField,    // Coluna movieId vazia
+        InvalidNumber, // Caracteres não numéricos no movieId
+        OutOfRange,    // movieId não cabe em int
+        Count
+    };
+
+    /**
+     * Modo de tratamento de linhas inválidas
+     * Fast: códigos de erro, sem alocação nem exceção, resumo único ao final
+     * Strict: lança/captura exceção e imprime cada linha inválida
+     */
+    enum class ParseMode
+    {
+        Fast,
+        Strict
+    };
+
+    /**
+     * Estratégia de leitura de arquivos não comprimidos
+     * Buffered: std::getline sobre std::ifstream
+     * Async: blocos alinhados em voo via io_uring (Linux), parsing na thread chamadora
+     */
+    enum class IOMode
+    {
+        Buffered,
+        Async
+    };
+
+    /**
+     * Estatísticas da última leitura
+     */
+    struct ParseStatistics
+    {
+        size_t linesRead = 0;
+        size_t accepted = 0;
+        std::array<size_t, static_cast<size_t>(ParseError::Count)> rejected{};
+        std::vector<size_t> sampleLines; // Números de linha (1 = cabeçalho)
+
+        size_t totalRejected() const;
+        void reset();
+    };
+
 private:
     std::string filename;
+    ParseMode parseMode;
+    IOMode ioMode;
+    RecordSampler::Mode samplingMode;
+    uint64_t samplingSeed;
+    size_t maxErrorSamples;
+    ParseStatistics lastStatistics;
 
 public:
     explicit CSVReader(const std::string &file);
 
     /**
      * Lê os movieIds do arquivo ratings.csv
-     * @param maxRecords Número máximo de registros a ler (0 = todos)
+     * @param maxRecords Número máximo de registros a ler (0 = todos);
+     *                   fora do modo Head é o tamanho da amostra sobre o arquivo inteiro
      * @return Vetor com os movieIds
      */
     std::vector<int> readMovieIds(size_t maxRecords = 0);
@@ -36,7 +98,80 @@ public:
      */
     size_t countLines() const;
 
+    /**
+     * Define o modo de tratamento de linhas inválidas
+     * @param mode Fast (padrão) ou Strict
+     */
+    void setParseMode(ParseMode mode);
+
+    /**
+     * Define a estratégia de leitura de arquivos não comprimidos
+     * @param mode Buffered (padrão) ou Async
+     */
+    void setIOMode(IOMode mode);
+
+    /**
+     * Define como os maxRecords registros são escolhidos
+     * @param mode Head (padrão), Reservoir ou Stride
+     * @param seed Semente do gerador (amostragem reproduzível)
+     */
+    void setSampling(RecordSampler::Mode mode, uint64_t seed = 42);
+
+    /**
+     * Define quantos números de linha inválida são guardados como amostra
+     * @param maxSamples Limite da amostra (0 = nenhuma)
+     */
+    void setMaxErrorSamples(size_t maxSamples);
+
+    /**
+     * Retorna as estatísticas da última chamada a readMovieIds
+     */
+    const ParseStatistics &getStatistics() const;
+
+    /**
+     * Imprime o resumo de linhas rejeitadas por categoria
+     * @param os Stream de saída
+     */
+    void printStatistics(std::ostream &os) const;
+
+    /**
+     * Nome legível de uma categoria de erro
+     */
+    static const char *errorName(ParseError error);
+
+    /**
+     * Extrai o movieId (segunda coluna) de uma linha sem alocar nem lançar exceção
+     * @param begin Início da linha
+     * @param end Fim da linha (exclusivo)
+     * @param movieId Recebe o valor quando o retorno é ParseError::None
+     * @return Categoria do erro ou ParseError::None
+     */
+    static ParseError parseMovieIdFast(const char *begin, const char *end, int &movieId) noexcept;
+
 private:
+    /**
+     * Lê em blocos: comprimidos via BlockPipeline, simples via AsyncFileReader
+     * @param sampler Destino dos registros válidos
+     * @return false se o arquivo não pôde ser aberto ou a leitura falhou
+     */
+    bool readMovieIdsFromBlocks(RecordSampler &sampler);
+
+    /**
+     * Processa uma linha (sem o '\n') conforme o modo de parsing
+     * @param begin Início da linha
+     * @param end Fim da linha (exclusivo)
+     * @param lineNumber Número da linha no arquivo (1 = cabeçalho)
+     * @param sampler Destino dos registros válidos
+     */
+    void consumeLine(const char *begin, const char *end, size_t lineNumber, RecordSampler &sampler);
+
+    /**
+     * Registra uma linha rejeitada nas estatísticas
+     * @param error Categoria do erro
+     * @param lineNumber Número da linha no arquivo
+     */
+    void recordRejection(ParseError error, size_t lineNumber);
+
     /**
      * Faz o parsing de uma linha CSV do ratings.csv e retorna o movieId
      * @param line Linha do CSV
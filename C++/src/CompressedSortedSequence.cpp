@@ -0,0 +1,296 @@
+#include "CompressedSortedSequence.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr size_t PADDING = 8;
+    constexpr size_t OFFSET_UNIT = CompressedSortedSequence::BLOCK_SIZE / 8;
+
+    unsigned bitsFor(uint32_t value)
+    {
+        unsigned bits = 0;
+        while (value != 0)
+        {
+            bits++;
+            value >>= 1;
+        }
+        return bits;
+    }
+
+    // Empacota as deltas de width bits em sequência (little-endian)
+    void packDeltas(const uint32_t *deltas, size_t length, unsigned width, uint8_t *dst)
+    {
+        uint64_t buffer = 0;
+        unsigned buffered = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            buffer |= static_cast<uint64_t>(deltas[i]) << buffered;
+            buffered += width;
+            while (buffered >= 8)
+            {
+                *dst++ = static_cast<uint8_t>(buffer);
+                buffer >>= 8;
+                buffered -= 8;
+            }
+        }
+        if (buffered > 0)
+        {
+            *dst = static_cast<uint8_t>(buffer);
+        }
+    }
+
+    // Cada delta é lido com uma carga de 8 bytes (largura <= 32, deslocamento <= 7)
+    void unpackDeltas(const uint8_t *src, size_t length, unsigned width, uint32_t *deltas)
+    {
+        const uint64_t mask = width == 32 ? 0xFFFFFFFFull : (uint64_t(1) << width) - 1;
+        for (size_t i = 0; i < length; ++i)
+        {
+            size_t bit = i * width;
+            uint64_t word;
+            std::memcpy(&word, src + bit / 8, sizeof(word));
+            deltas[i] = static_cast<uint32_t>((word >> (bit % 8)) & mask);
+        }
+    }
+
+    // Soma de prefixos de um bloco a partir de first; aritmética módulo 2^32
+    void prefixSum(const uint32_t *deltas, int first, int *out)
+    {
+        constexpr size_t length = CompressedSortedSequence::BLOCK_SIZE;
+#if defined(__SSE2__)
+        static_assert(length % 4 == 0, "bloco deve ter múltiplo de 4 valores");
+        __m128i carry = _mm_set1_epi32(first);
+        for (size_t i = 0; i < length; i += 4)
+        {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(deltas + i));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi32(x, carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), x);
+            carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+#else
+        uint32_t running = static_cast<uint32_t>(first);
+        for (size_t i = 0; i < length; ++i)
+        {
+            running += deltas[i];
+            out[i] = static_cast<int>(running);
+        }
+#endif
+    }
+}
+
+CompressedSortedSequence::CompressedSortedSequence()
+    : packed(PADDING, 0), packedSize(0), pendingCount(0), count(0)
+{
+}
+
+void CompressedSortedSequence::append(int value)
+{
+    if (count > 0)
+    {
+        int last = pendingCount > 0 ? pending[pendingCount - 1] : at(count - 1);
+        if (value < last)
+        {
+            throw std::invalid_argument("CompressedSortedSequence: valores fora de ordem");
+        }
+    }
+
+    pending[pendingCount++] = value;
+    count++;
+    if (pendingCount == BLOCK_SIZE)
+    {
+        flushPending();
+    }
+}
+
+void CompressedSortedSequence::appendRun(int value, size_t repetitions)
+{
+    if (repetitions == 0)
+    {
+        return;
+    }
+    append(value);
+    repetitions--;
+
+    // Completa o bloco pendente valor a valor
+    while (repetitions > 0 && pendingCount != 0)
+    {
+        pending[pendingCount++] = value;
+        count++;
+        repetitions--;
+        if (pendingCount == BLOCK_SIZE)
+        {
+            flushPending();
+        }
+    }
+
+    if (repetitions == 0)
+    {
+        return;
+    }
+
+    // Bloco pendente vazio: blocos inteiros de valores iguais não ocupam nenhum byte de deltas
+    while (repetitions >= BLOCK_SIZE)
+    {
+        blocks.push_back({value, static_cast<uint32_t>(packedSize / OFFSET_UNIT)});
+        count += BLOCK_SIZE;
+        repetitions -= BLOCK_SIZE;
+    }
+
+    std::fill(pending, pending + repetitions, value);
+    pendingCount = repetitions;
+    count += repetitions;
+}
+
+void CompressedSortedSequence::flushPending()
+{
+    uint32_t deltas[BLOCK_SIZE];
+    uint32_t maxDelta = 0;
+    deltas[0] = 0;
+    for (size_t i = 1; i < pendingCount; ++i)
+    {
+        deltas[i] = static_cast<uint32_t>(pending[i]) - static_cast<uint32_t>(pending[i - 1]);
+        maxDelta = std::max(maxDelta, deltas[i]);
+    }
+
+    unsigned width = bitsFor(maxDelta);
+    size_t bytes = width * OFFSET_UNIT;
+    if ((packedSize + bytes) / OFFSET_UNIT > UINT32_MAX)
+    {
+        throw std::length_error("CompressedSortedSequence: capacidade máxima excedida");
+    }
+    blocks.push_back({pending[0], static_cast<uint32_t>(packedSize / OFFSET_UNIT)});
+
+    packed.resize(packedSize + bytes + PADDING);
+    packDeltas(deltas, pendingCount, width, packed.data() + packedSize);
+    packedSize += bytes;
+    std::memset(packed.data() + packedSize, 0, PADDING);
+    pendingCount = 0;
+}
+
+void CompressedSortedSequence::clear()
+{
+    blocks.clear();
+    packed.assign(PADDING, 0);
+    packedSize = 0;
+    pendingCount = 0;
+    count = 0;
+}
+
+size_t CompressedSortedSequence::size() const
+{
+    return count;
+}
+
+bool CompressedSortedSequence::empty() const
+{
+    return count == 0;
+}
+
+size_t CompressedSortedSequence::compressedBytes() const
+{
+    return packedSize + blocks.size() * sizeof(Block) + pendingCount * sizeof(int);
+}
+
+size_t CompressedSortedSequence::blockCount() const
+{
+    return blocks.size() + (pendingCount > 0 ? 1 : 0);
+}
+
+int CompressedSortedSequence::blockFirstValue(size_t blockIndex) const
+{
+    return blockIndex < blocks.size() ? blocks[blockIndex].firstValue : pending[0];
+}
+
+unsigned CompressedSortedSequence::blockWidth(size_t blockIndex) const
+{
+    size_t end = blockIndex + 1 < blocks.size() ? blocks[blockIndex + 1].offset : packedSize / OFFSET_UNIT;
+    return static_cast<unsigned>(end - blocks[blockIndex].offset);
+}
+
+size_t CompressedSortedSequence::decodeBlock(size_t blockIndex, int *out) const
+{
+    if (blockIndex >= blocks.size())
+    {
+        std::memcpy(out, pending, pendingCount * sizeof(int));
+        return pendingCount;
+    }
+
+    const Block &block = blocks[blockIndex];
+    unsigned width = blockWidth(blockIndex);
+    if (width == 0)
+    {
+        std::fill(out, out + BLOCK_SIZE, block.firstValue);
+        return BLOCK_SIZE;
+    }
+
+    uint32_t deltas[BLOCK_SIZE];
+    unpackDeltas(packed.data() + block.offset * OFFSET_UNIT, BLOCK_SIZE, width, deltas);
+    prefixSum(deltas, block.firstValue, out);
+    return BLOCK_SIZE;
+}
+
+void CompressedSortedSequence::decode(std::vector<int> &out) const
+{
+    out.resize(count);
+    int *dest = out.data();
+    for (size_t b = 0; b < blockCount(); ++b)
+    {
+        dest += decodeBlock(b, dest);
+    }
+}
+
+int CompressedSortedSequence::at(size_t index) const
+{
+    if (index >= count)
+    {
+        throw std::out_of_range("CompressedSortedSequence: índice fora do intervalo");
+    }
+
+    int values[BLOCK_SIZE];
+    decodeBlock(index / BLOCK_SIZE, values);
+    return values[index % BLOCK_SIZE];
+}
+
+size_t CompressedSortedSequence::lowerBound(int value) const
+{
+    // Primeiro bloco cujo primeiro valor é >= value; a resposta está no
+    // bloco anterior ou é o início deste
+    size_t low = 0;
+    size_t high = blockCount();
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (blockFirstValue(middle) < value)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low == 0)
+    {
+        return 0;
+    }
+
+    int values[BLOCK_SIZE];
+    size_t length = decodeBlock(low - 1, values);
+    size_t position = std::lower_bound(values, values + length, value) - values;
+    return (low - 1) * BLOCK_SIZE + position;
+}
+
+bool CompressedSortedSequence::contains(int value) const
+{
+    size_t position = lowerBound(value);
+    return position < count && at(position) == value;
+}
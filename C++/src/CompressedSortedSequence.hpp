@@ -0,0 +1,97 @@
+#ifndef COMPRESSEDSORTEDSEQUENCE_HPP
+#define COMPRESSEDSORTEDSEQUENCE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Sequência não decrescente compactada por deltas
+ * Os valores são agrupados em blocos de BLOCK_SIZE; cada bloco guarda as
+ * diferenças para o valor anterior empacotadas na menor largura de bits
+ * que cobre a maior delas (0 bits para um bloco de valores iguais). Um
+ * índice de saltos (primeiro valor e deslocamento de cada bloco) permite
+ * busca binária decodificando um único bloco.
+ *
+ * O último bloco, ainda incompleto, fica sem compressão até encher.
+ */
+class CompressedSortedSequence
+{
+public:
+    static constexpr size_t BLOCK_SIZE = 128;
+
+private:
+    // Um bloco cheio de largura w ocupa exatamente 16 * w bytes: o início
+    // é guardado em unidades de 16 bytes e a largura sai da diferença para o próximo
+    struct Block
+    {
+        int firstValue;
+        uint32_t offset;
+    };
+
+    std::vector<Block> blocks;
+    std::vector<uint8_t> packed; // Deltas + PADDING bytes de folga para leituras de 8 bytes
+    size_t packedSize;
+    int pending[BLOCK_SIZE];     // Bloco em construção
+    size_t pendingCount;
+    size_t count;
+
+public:
+    CompressedSortedSequence();
+
+    /**
+     * Acrescenta um valor no fim
+     * @param value Deve ser >= último valor inserido
+     * @throws std::invalid_argument se a ordem for violada
+     */
+    void append(int value);
+
+    /**
+     * Acrescenta repetitions cópias de value; blocos inteiros de valores
+     * iguais são gravados direto como blocos de 0 bits
+     */
+    void appendRun(int value, size_t repetitions);
+
+    void clear();
+    size_t size() const;
+    bool empty() const;
+
+    /**
+     * Bytes ocupados: deltas empacotadas + índice de saltos + bloco pendente
+     */
+    size_t compressedBytes() const;
+
+    /**
+     * Decodifica a sequência inteira em out (conteúdo anterior é descartado)
+     */
+    void decode(std::vector<int> &out) const;
+
+    /**
+     * Decodifica um único bloco
+     * @param blockIndex Índice do bloco (o pendente é o último)
+     * @param out Recebe até BLOCK_SIZE valores
+     * @return Quantidade de valores do bloco
+     */
+    size_t decodeBlock(size_t blockIndex, int *out) const;
+
+    size_t blockCount() const;
+
+    /**
+     * Valor na posição index (decodifica só o bloco correspondente)
+     */
+    int at(size_t index) const;
+
+    /**
+     * Posição do primeiro valor >= value (size() se não houver)
+     */
+    size_t lowerBound(int value) const;
+
+    bool contains(int value) const;
+
+private:
+    void flushPending();
+    int blockFirstValue(size_t blockIndex) const;
+    unsigned blockWidth(size_t blockIndex) const;
+};
+
+#endif // COMPRESSEDSORTEDSEQUENCE_HPP
@@ -0,0 +1,227 @@
+#include "ConcurrentQueueStructure.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+ConcurrentQueueStructure::ConcurrentQueueStructure()
+    : DataStructure(true), directory(new std::atomic<Page *>[MAX_PAGES]), tail(0), head(0)
+{
+    for (size_t i = 0; i < MAX_PAGES; ++i)
+    {
+        directory[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ConcurrentQueueStructure::~ConcurrentQueueStructure()
+{
+    releaseSegments();
+    delete[] directory;
+}
+
+ConcurrentQueueStructure::Segment *ConcurrentQueueStructure::segmentFor(size_t position)
+{
+    size_t index = position >> SEGMENT_SHIFT;
+    size_t pageIndex = index >> PAGE_SHIFT;
+    if (pageIndex >= MAX_PAGES)
+    {
+        throw std::length_error("ConcurrentQueue: capacidade máxima excedida");
+    }
+
+    // Página e segmento seguem o mesmo protocolo: quem perder a corrida
+    // descarta o que criou e usa o instalado
+    Page *page = directory[pageIndex].load(std::memory_order_acquire);
+    if (page == nullptr)
+    {
+        Page *created = new Page();
+        if (directory[pageIndex].compare_exchange_strong(page, created,
+                                                         std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            page = created;
+        }
+        else
+        {
+            delete created;
+        }
+    }
+
+    std::atomic<Segment *> &entry = page->segments[index & (PAGE_SIZE - 1)];
+    Segment *segment = entry.load(std::memory_order_acquire);
+    if (segment != nullptr)
+    {
+        return segment;
+    }
+
+    Segment *created = new Segment();
+    if (entry.compare_exchange_strong(segment, created,
+                                      std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        return created;
+    }
+    delete created;
+    return segment;
+}
+
+ConcurrentQueueStructure::Segment *ConcurrentQueueStructure::findSegment(size_t position) const
+{
+    size_t index = position >> SEGMENT_SHIFT;
+    if ((index >> PAGE_SHIFT) >= MAX_PAGES)
+    {
+        return nullptr;
+    }
+    const Page *page = directory[index >> PAGE_SHIFT].load(std::memory_order_acquire);
+    if (page == nullptr)
+    {
+        return nullptr;
+    }
+    return page->segments[index & (PAGE_SIZE - 1)].load(std::memory_order_acquire);
+}
+
+void ConcurrentQueueStructure::insert(int value)
+{
+    size_t position = tail.fetch_add(1, std::memory_order_relaxed);
+    Segment *segment = segmentFor(position);
+    size_t slot = position & (SEGMENT_SIZE - 1);
+    segment->values[slot] = value;
+    segment->ready[slot].store(1, std::memory_order_release);
+}
+
+void ConcurrentQueueStructure::insertBatch(const int *values, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Um único fetch_add reserva o bloco; a cópia é feita por segmento
+    size_t position = tail.fetch_add(count, std::memory_order_relaxed);
+    size_t copied = 0;
+    while (copied < count)
+    {
+        Segment *segment = segmentFor(position + copied);
+        size_t slot = (position + copied) & (SEGMENT_SIZE - 1);
+        size_t chunk = std::min(count - copied, SEGMENT_SIZE - slot);
+
+        std::memcpy(segment->values + slot, values + copied, chunk * sizeof(int));
+        for (size_t i = 0; i < chunk; ++i)
+        {
+            segment->ready[slot + i].store(1, std::memory_order_release);
+        }
+        copied += chunk;
+    }
+}
+
+size_t ConcurrentQueueStructure::drain(std::vector<int> &out)
+{
+    size_t end = tail.load(std::memory_order_acquire);
+    size_t start = head;
+
+    while (head < end)
+    {
+        Segment *segment = findSegment(head);
+        if (segment == nullptr)
+        {
+            break;
+        }
+
+        size_t slot = head & (SEGMENT_SIZE - 1);
+        size_t limit = std::min(SEGMENT_SIZE, slot + (end - head));
+        size_t published = slot;
+        while (published < limit && segment->ready[published].load(std::memory_order_acquire) != 0)
+        {
+            published++;
+        }
+
+        out.insert(out.end(), segment->values + slot, segment->values + published);
+        head += published - slot;
+        if (published < limit)
+        {
+            break; // Posição reservada ainda sendo gravada
+        }
+    }
+
+    return head - start;
+}
+
+void ConcurrentQueueStructure::releaseSegments()
+{
+    for (size_t i = 0; i < MAX_PAGES; ++i)
+    {
+        Page *page = directory[i].exchange(nullptr, std::memory_order_relaxed);
+        if (page == nullptr)
+        {
+            continue;
+        }
+        for (size_t j = 0; j < PAGE_SIZE; ++j)
+        {
+            delete page->segments[j].load(std::memory_order_relaxed);
+        }
+        delete page;
+    }
+}
+
+void ConcurrentQueueStructure::clear()
+{
+    // Mantém os segmentos para reuso; só as flags das posições usadas são zeradas
+    size_t end = tail.load(std::memory_order_relaxed);
+    for (size_t index = 0; index * SEGMENT_SIZE < end; ++index)
+    {
+        Segment *segment = findSegment(index * SEGMENT_SIZE);
+        if (segment == nullptr)
+        {
+            continue;
+        }
+        size_t used = std::min(SEGMENT_SIZE, end - index * SEGMENT_SIZE);
+        for (size_t slot = 0; slot < used; ++slot)
+        {
+            segment->ready[slot].store(0, std::memory_order_relaxed);
+        }
+    }
+    tail.store(0, std::memory_order_relaxed);
+    head = 0;
+}
+
+std::vector<int> ConcurrentQueueStructure::toVector() const
+{
+    std::vector<int> result;
+    toVector(result);
+    return result;
+}
+
+void ConcurrentQueueStructure::toVector(std::vector<int> &out) const
+{
+    size_t end = tail.load(std::memory_order_acquire);
+    out.resize(end - head);
+
+    size_t position = head;
+    int *dest = out.data();
+    while (position < end)
+    {
+        const Segment *segment = findSegment(position);
+        size_t slot = position & (SEGMENT_SIZE - 1);
+        size_t chunk = std::min(SEGMENT_SIZE - slot, end - position);
+        std::memcpy(dest, segment->values + slot, chunk * sizeof(int));
+        dest += chunk;
+        position += chunk;
+    }
+}
+
+void ConcurrentQueueStructure::fromVector(const std::vector<int> &vec)
+{
+    clear();
+    insertBatch(vec.data(), vec.size());
+}
+
+std::string ConcurrentQueueStructure::getType() const
+{
+    return "Concurrent Queue";
+}
+
+size_t ConcurrentQueueStructure::size() const
+{
+    return tail.load(std::memory_order_acquire) - head;
+}
+
+bool ConcurrentQueueStructure::empty() const
+{
+    return size() == 0;
+}
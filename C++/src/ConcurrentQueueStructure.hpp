@@ -0,0 +1,79 @@
+#ifndef CONCURRENTQUEUESTRUCTURE_HPP
+#define CONCURRENTQUEUESTRUCTURE_HPP
+
+#include "DataStructure.hpp"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Fila segmentada multi-produtor (MPSC) sem locks
+ * Produtores reservam posições com um único fetch_add no índice de fim
+ * (insertBatch reserva o bloco inteiro de uma vez), gravam o valor e
+ * publicam a posição com uma flag por slot. Segmentos e as páginas do
+ * diretório que os indexam são criados sob demanda, instalados por CAS e
+ * reaproveitados após clear(). Um único consumidor esvazia o prefixo
+ * publicado com drain().
+ *
+ * insert/insertBatch podem ser chamados de várias threads ao mesmo tempo;
+ * drain de uma thread consumidora; clear/fromVector/toVector exigem
+ * que não haja produtores ativos.
+ */
+class ConcurrentQueueStructure : public DataStructure
+{
+private:
+    static constexpr unsigned SEGMENT_SHIFT = 16;
+    static constexpr size_t SEGMENT_SIZE = size_t(1) << SEGMENT_SHIFT;
+    static constexpr unsigned PAGE_SHIFT = 12;
+    static constexpr size_t PAGE_SIZE = size_t(1) << PAGE_SHIFT; // Segmentos por página
+    static constexpr size_t MAX_PAGES = 4096;                      // Até 2^40 elementos
+
+    struct Segment
+    {
+        int values[SEGMENT_SIZE];
+        std::atomic<uint8_t> ready[SEGMENT_SIZE];
+    };
+
+    struct Page
+    {
+        std::atomic<Segment *> segments[PAGE_SIZE];
+    };
+
+    std::atomic<Page *> *directory;
+    alignas(64) std::atomic<size_t> tail; // Próxima posição a reservar
+    alignas(64) size_t head;              // Próxima posição a consumir
+
+public:
+    ConcurrentQueueStructure();
+    ~ConcurrentQueueStructure() override;
+
+    ConcurrentQueueStructure(const ConcurrentQueueStructure &) = delete;
+    ConcurrentQueueStructure &operator=(const ConcurrentQueueStructure &) = delete;
+
+    void insert(int value) override;
+    void clear() override;
+    std::vector<int> toVector() const override;
+    void fromVector(const std::vector<int> &vec) override;
+    std::string getType() const override;
+
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+
+    size_t size() const override;
+    bool empty() const override;
+
+    /**
+     * Move para out (anexando) todos os valores já publicados, em ordem
+     * Para na primeira posição reservada mas ainda não publicada
+     * @param out Vetor de destino
+     * @return Quantidade de valores consumidos
+     */
+    size_t drain(std::vector<int> &out);
+
+private:
+    Segment *segmentFor(size_t position);
+    Segment *findSegment(size_t position) const;
+    void releaseSegments();
+};
+
+#endif // CONCURRENTQUEUESTRUCTURE_HPP
@@ -0,0 +1,259 @@
+#include "ConcurrentStackStructure.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+ConcurrentStackStructure::ConcurrentStackStructure()
+    : DataStructure(true), top(nullptr), count(0), hazards(new HazardRecord[MAX_HAZARDS])
+{
+}
+
+ConcurrentStackStructure::~ConcurrentStackStructure()
+{
+    clear();
+    delete[] hazards;
+}
+
+ConcurrentStackStructure::HazardRecord *ConcurrentStackStructure::acquireHazard()
+{
+    // Procura um registro livre; se todos estiverem ocupados, espera
+    while (true)
+    {
+        for (size_t i = 0; i < MAX_HAZARDS; ++i)
+        {
+            bool expected = false;
+            if (!hazards[i].active.load(std::memory_order_relaxed) &&
+                hazards[i].active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                return &hazards[i];
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+void ConcurrentStackStructure::releaseHazard(HazardRecord *record)
+{
+    record->pointer.store(nullptr, std::memory_order_release);
+    record->active.store(false, std::memory_order_release);
+}
+
+void ConcurrentStackStructure::linkChain(Node *first, Node *last, size_t length)
+{
+    Node *expected = top.load(std::memory_order_relaxed);
+    do
+    {
+        last->next = expected;
+    } while (!top.compare_exchange_weak(expected, first, std::memory_order_release, std::memory_order_relaxed));
+    count.fetch_add(length, std::memory_order_relaxed);
+}
+
+void ConcurrentStackStructure::push(int value)
+{
+    Node *newNode = new Node(value);
+    linkChain(newNode, newNode, 1);
+}
+
+void ConcurrentStackStructure::pushBatch(const int *values, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    // first = topo da cadeia (último valor), last = base
+    Node *last = new Node(values[0]);
+    Node *first = last;
+    for (size_t i = 1; i < length; ++i)
+    {
+        Node *newNode = new Node(values[i]);
+        newNode->next = first;
+        first = newNode;
+    }
+    linkChain(first, last, length);
+}
+
+bool ConcurrentStackStructure::popWith(HazardRecord *record, int &value)
+{
+    Node *current = top.load(std::memory_order_acquire);
+    while (current != nullptr)
+    {
+        // Publica o hazard e confirma que o nó ainda é o topo antes de tocá-lo
+        record->pointer.store(current, std::memory_order_seq_cst);
+        Node *confirmed = top.load(std::memory_order_seq_cst);
+        if (confirmed != current)
+        {
+            current = confirmed;
+            continue;
+        }
+
+        Node *next = current->next;
+        if (top.compare_exchange_strong(current, next, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            record->pointer.store(nullptr, std::memory_order_release);
+            value = current->data;
+            count.fetch_sub(1, std::memory_order_relaxed);
+            retire(record, current);
+            return true;
+        }
+    }
+
+    record->pointer.store(nullptr, std::memory_order_release);
+    return false;
+}
+
+bool ConcurrentStackStructure::pop(int &value)
+{
+    HazardRecord *record = acquireHazard();
+    bool popped = popWith(record, value);
+    releaseHazard(record);
+    return popped;
+}
+
+size_t ConcurrentStackStructure::popBatch(int *out, size_t maxCount)
+{
+    HazardRecord *record = acquireHazard();
+    size_t popped = 0;
+    while (popped < maxCount && popWith(record, out[popped]))
+    {
+        popped++;
+    }
+    releaseHazard(record);
+    return popped;
+}
+
+size_t ConcurrentStackStructure::drain(std::vector<int> &out)
+{
+    // Ninguém mais alcança a cadeia, mas poppers concorrentes podem ainda
+    // estar lendo o antigo topo: os nós são aposentados, não liberados
+    Node *chain = top.exchange(nullptr, std::memory_order_acq_rel);
+    if (chain == nullptr)
+    {
+        return 0;
+    }
+
+    HazardRecord *record = acquireHazard();
+    size_t drained = 0;
+    while (chain != nullptr)
+    {
+        Node *next = chain->next;
+        out.push_back(chain->data);
+        retire(record, chain);
+        chain = next;
+        drained++;
+    }
+    count.fetch_sub(drained, std::memory_order_relaxed);
+    releaseHazard(record);
+    return drained;
+}
+
+void ConcurrentStackStructure::retire(HazardRecord *record, Node *node)
+{
+    record->retired.push_back(node);
+    if (record->retired.size() >= RETIRE_THRESHOLD)
+    {
+        scan(record);
+    }
+}
+
+void ConcurrentStackStructure::scan(HazardRecord *record)
+{
+    std::vector<Node *> protectedNodes;
+    protectedNodes.reserve(MAX_HAZARDS);
+    for (size_t i = 0; i < MAX_HAZARDS; ++i)
+    {
+        Node *hazard = hazards[i].pointer.load(std::memory_order_seq_cst);
+        if (hazard != nullptr)
+        {
+            protectedNodes.push_back(hazard);
+        }
+    }
+    std::sort(protectedNodes.begin(), protectedNodes.end());
+
+    // Libera o que não está protegido; o restante espera a próxima varredura
+    std::vector<Node *> &retired = record->retired;
+    auto kept = std::partition(retired.begin(), retired.end(), [&](Node *node)
+                               { return std::binary_search(protectedNodes.begin(), protectedNodes.end(), node); });
+    for (auto it = kept; it != retired.end(); ++it)
+    {
+        delete *it;
+    }
+    retired.erase(kept, retired.end());
+}
+
+void ConcurrentStackStructure::insert(int value)
+{
+    push(value);
+}
+
+void ConcurrentStackStructure::insertBatch(const int *values, size_t length)
+{
+    pushBatch(values, length);
+}
+
+void ConcurrentStackStructure::clear()
+{
+    Node *chain = top.exchange(nullptr, std::memory_order_acq_rel);
+    while (chain != nullptr)
+    {
+        Node *next = chain->next;
+        delete chain;
+        chain = next;
+    }
+    count.store(0, std::memory_order_relaxed);
+
+    // Sem threads ativas nenhum hazard está publicado
+    for (size_t i = 0; i < MAX_HAZARDS; ++i)
+    {
+        for (Node *node : hazards[i].retired)
+        {
+            delete node;
+        }
+        hazards[i].retired.clear();
+    }
+}
+
+std::vector<int> ConcurrentStackStructure::toVector() const
+{
+    std::vector<int> result;
+    toVector(result);
+    return result;
+}
+
+void ConcurrentStackStructure::toVector(std::vector<int> &out) const
+{
+    // Do topo para a base, preenchendo de trás para frente (base → topo)
+    size_t length = 0;
+    for (Node *node = top.load(std::memory_order_acquire); node != nullptr; node = node->next)
+    {
+        length++;
+    }
+
+    out.resize(length);
+    int *dest = out.data() + length;
+    for (Node *node = top.load(std::memory_order_acquire); node != nullptr; node = node->next)
+    {
+        *--dest = node->data;
+    }
+}
+
+void ConcurrentStackStructure::fromVector(const std::vector<int> &vec)
+{
+    clear();
+    pushBatch(vec.data(), vec.size());
+}
+
+std::string ConcurrentStackStructure::getType() const
+{
+    return "Concurrent Stack";
+}
+
+size_t ConcurrentStackStructure::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+bool ConcurrentStackStructure::empty() const
+{
+    return top.load(std::memory_order_acquire) == nullptr;
+}
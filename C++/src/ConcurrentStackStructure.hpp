@@ -0,0 +1,102 @@
+#ifndef CONCURRENTSTACKSTRUCTURE_HPP
+#define CONCURRENTSTACKSTRUCTURE_HPP
+
+#include "DataStructure.hpp"
+#include <atomic>
+#include <vector>
+
+/**
+ * Pilha de Treiber sem locks com reclamação por hazard pointers
+ * push/pop trocam o topo por CAS; antes de ler top->next, pop publica o
+ * nó num hazard pointer, de modo que nenhum nó protegido é liberado (e
+ * reaproveitado pelo alocador) enquanto outra thread o observa — o que
+ * elimina o problema ABA. Nós removidos vão para a lista de aposentados
+ * do registro de hazard em uso e só são liberados quando nenhum registro
+ * os protege.
+ *
+ * push/pop/pushBatch/popBatch/drain podem ser chamados de várias threads;
+ * clear/fromVector/toVector exigem que não haja outras threads ativas.
+ */
+class ConcurrentStackStructure : public DataStructure
+{
+private:
+    struct Node
+    {
+        int data;
+        Node *next;
+        Node(int value) : data(value), next(nullptr) {}
+    };
+
+    static constexpr size_t MAX_HAZARDS = 128;      // Threads simultâneas em pop
+    static constexpr size_t RETIRE_THRESHOLD = 256; // Aposentados antes de uma varredura
+
+    // Registro de hazard: adquirido por uma thread durante a operação
+    struct alignas(64) HazardRecord
+    {
+        std::atomic<Node *> pointer{nullptr};
+        std::atomic<bool> active{false};
+        std::vector<Node *> retired; // Só acessado por quem detém o registro
+    };
+
+    alignas(64) std::atomic<Node *> top;
+    alignas(64) std::atomic<size_t> count;
+    HazardRecord *hazards;
+
+public:
+    ConcurrentStackStructure();
+    ~ConcurrentStackStructure() override;
+
+    ConcurrentStackStructure(const ConcurrentStackStructure &) = delete;
+    ConcurrentStackStructure &operator=(const ConcurrentStackStructure &) = delete;
+
+    void insert(int value) override;
+    void clear() override;
+    std::vector<int> toVector() const override;
+    void fromVector(const std::vector<int> &vec) override;
+    std::string getType() const override;
+
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+
+    size_t size() const override;
+    bool empty() const override;
+
+    void push(int value);
+
+    /**
+     * Remove o topo
+     * @param value Recebe o valor removido
+     * @return false se a pilha estava vazia
+     */
+    bool pop(int &value);
+
+    /**
+     * Empilha values[0..count) com um único CAS: a cadeia é montada
+     * localmente e ligada ao topo de uma vez (values[count-1] fica no topo)
+     */
+    void pushBatch(const int *values, size_t count);
+
+    /**
+     * Remove até maxCount elementos do topo usando um único registro de hazard
+     * @return Quantidade removida
+     */
+    size_t popBatch(int *out, size_t maxCount);
+
+    /**
+     * Desliga a pilha inteira com uma troca atômica e anexa os valores a
+     * out, do topo para a base
+     * @return Quantidade removida
+     */
+    size_t drain(std::vector<int> &out);
+
+private:
+    HazardRecord *acquireHazard();
+    void releaseHazard(HazardRecord *record);
+    bool popWith(HazardRecord *record, int &value);
+    void retire(HazardRecord *record, Node *node);
+    void scan(HazardRecord *record);
+    void linkChain(Node *first, Node *last, size_t length);
+};
+
+#endif // CONCURRENTSTACKSTRUCTURE_HPP
@@ -1,4 +1,9 @@
 #include "CountingSort.hpp"
+#include "DataStructure.hpp"
+#include "PackedVectorStructure.hpp"
+#include "CompressedSortedSequence.hpp"
+#include "BenchmarkClock.hpp"
+#include <cstdint>
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
@@ -24,13 +29,28 @@ std::vector<int> CountingSort::sort(const std::vector<int> &arr)
         return arr;
     }
 
+    std::vector<int> output;
+    std::vector<size_t> count;
+    sortInto(arr, output, count);
+    return output;
+}
+
+void CountingSort::sortInto(const std::vector<int> &arr, std::vector<int> &output,
+                            std::vector<size_t> &count)
+{
+    output.resize(arr.size());
+    if (arr.empty())
+    {
+        return;
+    }
+
     // Encontra o valor mínimo e máximo
     int minVal = findMin(arr);
     int maxVal = findMax(arr);
-    int range = maxVal - minVal + 1;
+    size_t range = static_cast<size_t>(static_cast<int64_t>(maxVal) - minVal + 1);
 
-    // Array de contagem
-    std::vector<int> count(range, 0);
+    // Array de contagem (assign mantém a capacidade de chamadas anteriores)
+    count.assign(range, 0);
 
     // Conta as ocorrências de cada elemento
     for (int num : arr)
@@ -39,37 +59,147 @@ std::vector<int> CountingSort::sort(const std::vector<int> &arr)
     }
 
     // Modifica count[i] para conter a posição real de cada elemento
-    for (int i = 1; i < range; i++)
+    for (size_t i = 1; i < range; i++)
     {
         count[i] += count[i - 1];
     }
 
-    // Array de saída
-    std::vector<int> output(arr.size());
-
     // Constroi o array de saída
-    for (int i = arr.size() - 1; i >= 0; i--)
+    for (size_t i = arr.size(); i-- > 0;)
     {
         output[count[arr[i] - minVal] - 1] = arr[i];
         count[arr[i] - minVal]--;
     }
-
-    return output;
 }
 
 std::vector<int> CountingSort::sortWithTiming(const std::vector<int> &arr,
-                                              std::chrono::milliseconds &executionTime)
+                                              std::chrono::nanoseconds &executionTime)
 {
-    auto start = std::chrono::high_resolution_clock::now();
+    uint64_t start = BenchmarkClock::now();
 
     std::vector<int> result = sort(arr);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    uint64_t end = BenchmarkClock::now();
+    executionTime = BenchmarkClock::elapsed(start, end);
 
     return result;
 }
 
+void CountingSort::sortCompressed(const std::vector<int> &arr, CompressedSortedSequence &output)
+{
+    output.clear();
+    if (arr.empty())
+    {
+        return;
+    }
+
+    int minVal = findMin(arr);
+    int maxVal = findMax(arr);
+    size_t range = static_cast<size_t>(static_cast<int64_t>(maxVal) - minVal + 1);
+
+    std::vector<size_t> count(range, 0);
+    for (int num : arr)
+    {
+        count[num - minVal]++;
+    }
+
+    for (size_t bucket = 0; bucket < range; ++bucket)
+    {
+        output.appendRun(static_cast<int>(minVal + static_cast<int64_t>(bucket)), count[bucket]);
+    }
+}
+
+void CountingSort::sortInPlace(DataStructure &structure)
+{
+    // O vetor compactado é contado e regravado sem passar por blocos de int
+    if (auto *packed = dynamic_cast<PackedVectorStructure *>(&structure))
+    {
+        sortPacked(*packed);
+        return;
+    }
+
+    // Encontra o valor mínimo e máximo direto nos blocos da estrutura
+    bool hasValues = false;
+    int minVal = 0;
+    int maxVal = 0;
+    structure.forEachChunk([&](const int *values, size_t count)
+                           {
+        if (!hasValues)
+        {
+            minVal = maxVal = values[0];
+            hasValues = true;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            minVal = std::min(minVal, values[i]);
+            maxVal = std::max(maxVal, values[i]);
+        } });
+
+    if (!hasValues)
+    {
+        return;
+    }
+
+    // Conta as ocorrências de cada elemento
+    size_t range = static_cast<size_t>(static_cast<int64_t>(maxVal) - minVal + 1);
+    std::vector<size_t> count(range, 0);
+    structure.forEachChunk([&](const int *values, size_t length)
+                           {
+        for (size_t i = 0; i < length; ++i)
+        {
+            count[values[i] - minVal]++;
+        } });
+
+    // Regrava os valores em ordem crescente sobre o armazenamento original
+    size_t bucket = 0;
+    structure.updateEachChunk([&](int *values, size_t length)
+                              {
+        for (size_t i = 0; i < length; ++i)
+        {
+            while (count[bucket] == 0)
+            {
+                bucket++;
+            }
+            values[i] = static_cast<int>(minVal + static_cast<int64_t>(bucket));
+            count[bucket]--;
+        } });
+}
+
+void CountingSort::sortPacked(PackedVectorStructure &structure)
+{
+    std::vector<size_t> count;
+    structure.countCodes(count);
+    structure.assignSortedCodes(count);
+}
+
+void CountingSort::sortRelinked(DataStructure &structure)
+{
+    // Estruturas não encadeadas regravam os valores no lugar
+    if (!structure.relinkSort())
+    {
+        sortInPlace(structure);
+    }
+}
+
+void CountingSort::sortInPlaceWithTiming(DataStructure &structure,
+                                         std::chrono::nanoseconds &executionTime,
+                                         bool relink)
+{
+    uint64_t start = BenchmarkClock::now();
+
+    if (relink)
+    {
+        sortRelinked(structure);
+    }
+    else
+    {
+        sortInPlace(structure);
+    }
+
+    uint64_t end = BenchmarkClock::now();
+    executionTime = BenchmarkClock::elapsed(start, end);
+}
+
 bool CountingSort::isSorted(const std::vector<int> &arr)
 {
     for (size_t i = 1; i < arr.size(); i++)
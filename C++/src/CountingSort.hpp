@@ -5,6 +5,10 @@
 #include <chrono>
 #include <string>
 
+class DataStructure;
+class PackedVectorStructure;
+class CompressedSortedSequence;
+
 /**
  * Implementação do algoritmo Counting Sort
  * Algoritmo de ordenação não comparativo com complexidade O(n+k)
@@ -23,14 +27,63 @@ public:
      */
     static std::vector<int> sort(const std::vector<int> &arr);
 
+    /**
+     * Ordena em buffers do chamador, sem alocar quando já têm capacidade
+     * @param arr Vetor a ser ordenado
+     * @param output Recebe os valores ordenados (redimensionado para arr.size())
+     * @param count Histograma de trabalho (conteúdo anterior é descartado)
+     */
+    static void sortInto(const std::vector<int> &arr, std::vector<int> &output,
+                         std::vector<size_t> &count);
+
     /**
      * Ordena um vetor usando Counting Sort com medição de tempo
      * @param arr Vetor a ser ordenado
-     * @param executionTime Referência para armazenar o tempo de execução
+     * @param executionTime Referência para armazenar o tempo de execução (BenchmarkClock)
      * @return Vetor ordenado
      */
     static std::vector<int> sortWithTiming(const std::vector<int> &arr,
-                                           std::chrono::milliseconds &executionTime);
+                                           std::chrono::nanoseconds &executionTime);
+
+    /**
+     * Ordena a estrutura no próprio armazenamento, sem toVector/fromVector
+     * O histograma é montado sobre os blocos de forEachChunk e os valores
+     * ordenados são regravados por updateEachChunk
+     * @param structure Estrutura a ser ordenada
+     */
+    static void sortInPlace(DataStructure &structure);
+
+    /**
+     * Ordena emitindo direto na sequência compactada: cada balde do
+     * histograma vira um appendRun, sem materializar o vetor ordenado
+     * @param arr Vetor a ser ordenado
+     * @param output Recebe os valores ordenados (conteúdo anterior é descartado)
+     */
+    static void sortCompressed(const std::vector<int> &arr, CompressedSortedSequence &output);
+
+    /**
+     * Ordena o vetor compactado sem desempacotar: o histograma sai direto
+     * dos bytes (countCodes) e os trechos ordenados são regravados byte a byte
+     * @param structure Vetor compactado a ser ordenado
+     */
+    static void sortPacked(PackedVectorStructure &structure);
+
+    /**
+     * Ordena estruturas encadeadas religando os nós em baldes (LinkedSort),
+     * sem alocar nem copiar valores; as demais usam sortInPlace
+     * @param structure Estrutura a ser ordenada
+     */
+    static void sortRelinked(DataStructure &structure);
+
+    /**
+     * Ordena a estrutura no lugar com medição de tempo
+     * @param structure Estrutura a ser ordenada
+     * @param executionTime Referência para armazenar o tempo de execução (BenchmarkClock)
+     * @param relink Usa sortRelinked em vez de sortInPlace
+     */
+    static void sortInPlaceWithTiming(DataStructure &structure,
+                                      std::chrono::nanoseconds &executionTime,
+                                      bool relink = false);
 
     /**
      * Verifica se um vetor está ordenado
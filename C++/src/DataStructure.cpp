@@ -7,4 +7,55 @@ std::ostream &operator<<(std::ostream &os, const DataStructure &ds)
        << " | Size: " << ds.size()
        << " | Dynamic: " << (ds.getDynamic() ? "Yes" : "No");
     return os;
+}
+
+void DataStructure::insertBatch(const int *values, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        insert(values[i]);
+    }
+}
+
+void DataStructure::toVector(std::vector<int> &out) const
+{
+    out = toVector();
+}
+
+std::vector<int> DataStructure::takeVector()
+{
+    std::vector<int> result;
+    toVector(result);
+    clear();
+    return result;
+}
+
+void DataStructure::fromVector(std::vector<int> &&vec)
+{
+    fromVector(static_cast<const std::vector<int> &>(vec));
+}
+
+void DataStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    std::vector<int> copy;
+    toVector(copy);
+    if (!copy.empty())
+    {
+        visitor(copy.data(), copy.size());
+    }
+}
+
+void DataStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    std::vector<int> values = takeVector();
+    if (!values.empty())
+    {
+        visitor(values.data(), values.size());
+    }
+    fromVector(std::move(values));
+}
+
+bool DataStructure::relinkSort()
+{
+    return false;
 }
\ No newline at end of file
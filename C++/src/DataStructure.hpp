@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <string>
+#include <functional>
+#include <cstddef>
 
 /**
  * Classe base abstrata para diferentes estruturas de dados
@@ -10,10 +12,84 @@
  */
 class DataStructure
 {
+public:
+    // Recebem blocos contíguos do conteúdo, na mesma ordem de toVector()
+    using ChunkVisitor = std::function<void(const int *, size_t)>;
+    using MutableChunkVisitor = std::function<void(int *, size_t)>;
+
 protected:
     std::vector<int> data;
     bool isDynamic;
 
+    static constexpr size_t STAGE_SIZE = 1024;
+
+    /**
+     * Agrupa valores espalhados (ex.: um por nó) em blocos para o visitante
+     * @param next Devolve o endereço do próximo valor ou nullptr no fim
+     */
+    template <typename Next>
+    static void visitStaged(Next next, const ChunkVisitor &visitor)
+    {
+        int values[STAGE_SIZE];
+        size_t count;
+        do
+        {
+            count = 0;
+            const int *value;
+            while (count < STAGE_SIZE && (value = next()) != nullptr)
+            {
+                values[count++] = *value;
+            }
+            if (count > 0)
+            {
+                visitor(values, count);
+            }
+        } while (count == STAGE_SIZE);
+    }
+
+    // Visita os trechos contíguos de um contêiner segmentado (ex.: blocos da std::deque)
+    template <typename Container, typename Visitor>
+    static void visitContiguousRuns(Container &container, const Visitor &visitor)
+    {
+        auto it = container.begin();
+        while (it != container.end())
+        {
+            auto *start = &*it;
+            size_t length = 1;
+            while (++it != container.end() && &*it == start + length)
+            {
+                length++;
+            }
+            visitor(start, length);
+        }
+    }
+
+    // Como visitStaged, gravando de volta nos nós o que o visitante alterou
+    template <typename Next>
+    static void updateStaged(Next next, const MutableChunkVisitor &visitor)
+    {
+        int values[STAGE_SIZE];
+        int *slots[STAGE_SIZE];
+        size_t count;
+        do
+        {
+            count = 0;
+            while (count < STAGE_SIZE && (slots[count] = next()) != nullptr)
+            {
+                values[count] = *slots[count];
+                count++;
+            }
+            if (count > 0)
+            {
+                visitor(values, count);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    *slots[i] = values[i];
+                }
+            }
+        } while (count == STAGE_SIZE);
+    }
+
 public:
     DataStructure(bool dynamic = false) : isDynamic(dynamic) {}
     virtual ~DataStructure() = default;
@@ -25,6 +101,52 @@ public:
     virtual void fromVector(const std::vector<int> &vec) = 0;
     virtual std::string getType() const = 0;
 
+    // Operações em bloco; as implementações padrão recorrem às operações acima
+    // e as classes filhas as sobrescrevem com cópias contíguas
+
+    /**
+     * Insere count valores no fim da estrutura, na ordem dada
+     * @param values Início do bloco de valores
+     * @param count Quantidade de valores
+     */
+    virtual void insertBatch(const int *values, size_t count);
+
+    /**
+     * Copia o conteúdo para out, reaproveitando a capacidade já alocada
+     * @param out Vetor de destino (conteúdo anterior é descartado)
+     */
+    virtual void toVector(std::vector<int> &out) const;
+
+    /**
+     * Entrega o conteúdo e deixa a estrutura vazia; pode mover o armazenamento interno
+     */
+    virtual std::vector<int> takeVector();
+
+    /**
+     * Substitui o conteúdo; pode adotar o armazenamento de vec sem cópia
+     */
+    virtual void fromVector(std::vector<int> &&vec);
+
+    // Acesso sem cópia ao armazenamento nativo; o padrão passa por toVector/fromVector
+
+    /**
+     * Entrega o conteúdo ao visitante em blocos contíguos, sem copiar quando possível
+     * @param visitor Chamado para cada bloco, em ordem (a pilha dinâmica vai do topo à base)
+     */
+    virtual void forEachChunk(const ChunkVisitor &visitor) const;
+
+    /**
+     * Como forEachChunk, mas o visitante pode reescrever os valores no lugar
+     * @param visitor Chamado para cada bloco, em ordem
+     */
+    virtual void updateEachChunk(const MutableChunkVisitor &visitor);
+
+    /**
+     * Ordena religando os nós, sem alocar nem copiar valores (LinkedSort)
+     * @return false se a estrutura não é encadeada e nada foi feito
+     */
+    virtual bool relinkSort();
+
     // Métodos comuns
     virtual size_t size() const { return data.size(); }
     virtual bool empty() const { return data.empty(); }
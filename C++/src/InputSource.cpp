@@ -0,0 +1,209 @@
+#include "InputSource.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <climits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace
+{
+    bool endsWith(const std::string &str, const std::string &suffix)
+    {
+        return str.size() >= suffix.size() &&
+               str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    class FileInputSource : public InputSource
+    {
+    private:
+        std::FILE *file;
+
+    public:
+        explicit FileInputSource(const std::string &filename)
+            : file(std::fopen(filename.c_str(), "rb"))
+        {
+            if (file == nullptr)
+            {
+                throw std::runtime_error("Não foi possível abrir o arquivo " + filename);
+            }
+        }
+
+        ~FileInputSource() override
+        {
+            std::fclose(file);
+        }
+
+        size_t read(char *buffer, size_t capacity) override
+        {
+            size_t bytes = std::fread(buffer, 1, capacity, file);
+            if (bytes < capacity && std::ferror(file))
+            {
+                throw std::runtime_error("Erro de leitura do arquivo");
+            }
+            return bytes;
+        }
+
+        std::string getType() const override
+        {
+            return "plain";
+        }
+    };
+
+#ifdef USE_ZLIB
+    class GzipInputSource : public InputSource
+    {
+    private:
+        gzFile file;
+
+    public:
+        explicit GzipInputSource(const std::string &filename)
+            : file(gzopen(filename.c_str(), "rb"))
+        {
+            if (file == nullptr)
+            {
+                throw std::runtime_error("Não foi possível abrir o arquivo " + filename);
+            }
+            gzbuffer(file, 1 << 18);
+        }
+
+        ~GzipInputSource() override
+        {
+            gzclose(file);
+        }
+
+        size_t read(char *buffer, size_t capacity) override
+        {
+            // gzread recebe unsigned e retorna int
+            unsigned request = static_cast<unsigned>(std::min<size_t>(capacity, INT_MAX));
+            int bytes = gzread(file, buffer, request);
+            // Fluxo truncado: gzread devolve o que conseguiu e marca Z_BUF_ERROR
+            int errnum = Z_OK;
+            const char *message = gzerror(file, &errnum);
+            if (bytes < 0 || (errnum != Z_OK && errnum != Z_STREAM_END))
+            {
+                throw std::runtime_error(std::string("Erro de descompressão gzip: ") + message);
+            }
+            return static_cast<size_t>(bytes);
+        }
+
+        std::string getType() const override
+        {
+            return "gzip";
+        }
+    };
+#endif
+
+#ifdef USE_ZSTD
+    class ZstdInputSource : public InputSource
+    {
+    private:
+        std::FILE *file;
+        ZSTD_DStream *stream;
+        std::vector<char> input;
+        ZSTD_inBuffer inBuffer;
+        bool endOfFile;
+        bool frameOpen; // Último ZSTD_decompressStream não terminou o frame
+
+    public:
+        explicit ZstdInputSource(const std::string &filename)
+            : file(std::fopen(filename.c_str(), "rb")), stream(ZSTD_createDStream()),
+              input(ZSTD_DStreamInSize()), inBuffer{input.data(), 0, 0}, endOfFile(false),
+              frameOpen(false)
+        {
+            if (file == nullptr)
+            {
+                ZSTD_freeDStream(stream);
+                throw std::runtime_error("Não foi possível abrir o arquivo " + filename);
+            }
+            ZSTD_initDStream(stream);
+        }
+
+        ~ZstdInputSource() override
+        {
+            ZSTD_freeDStream(stream);
+            std::fclose(file);
+        }
+
+        size_t read(char *buffer, size_t capacity) override
+        {
+            ZSTD_outBuffer outBuffer{buffer, capacity, 0};
+
+            while (outBuffer.pos < outBuffer.size)
+            {
+                if (inBuffer.pos == inBuffer.size)
+                {
+                    if (endOfFile)
+                    {
+                        break;
+                    }
+                    inBuffer.size = std::fread(input.data(), 1, input.size(), file);
+                    inBuffer.pos = 0;
+                    if (std::ferror(file))
+                    {
+                        throw std::runtime_error("Erro de leitura do arquivo zstd");
+                    }
+                    if (inBuffer.size == 0)
+                    {
+                        if (frameOpen)
+                        {
+                            throw std::runtime_error("Erro de descompressão zstd: arquivo truncado no meio de um frame");
+                        }
+                        endOfFile = true;
+                        break;
+                    }
+                }
+
+                size_t ret = ZSTD_decompressStream(stream, &outBuffer, &inBuffer);
+                if (ZSTD_isError(ret))
+                {
+                    throw std::runtime_error(std::string("Erro de descompressão zstd: ") + ZSTD_getErrorName(ret));
+                }
+                frameOpen = ret != 0;
+            }
+
+            return outBuffer.pos;
+        }
+
+        std::string getType() const override
+        {
+            return "zstd";
+        }
+    };
+#endif
+}
+
+bool isCompressedFile(const std::string &filename)
+{
+    return endsWith(filename, ".gz") || endsWith(filename, ".zst");
+}
+
+std::unique_ptr<InputSource> createInputSource(const std::string &filename)
+{
+    if (endsWith(filename, ".gz"))
+    {
+#ifdef USE_ZLIB
+        return std::make_unique<GzipInputSource>(filename);
+#else
+        throw std::runtime_error("Suporte a gzip não compilado (use -DUSE_ZLIB -lz)");
+#endif
+    }
+
+    if (endsWith(filename, ".zst"))
+    {
+#ifdef USE_ZSTD
+        return std::make_unique<ZstdInputSource>(filename);
+#else
+        throw std::runtime_error("Suporte a zstd não compilado (use -DUSE_ZSTD -lzstd)");
+#endif
+    }
+
+    return std::make_unique<FileInputSource>(filename);
+}
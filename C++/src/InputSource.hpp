@@ -0,0 +1,44 @@
+#ifndef INPUTSOURCE_HPP
+#define INPUTSOURCE_HPP
+
+#include <string>
+#include <memory>
+#include <cstddef>
+
+/**
+ * Fonte de bytes lida em blocos pelo CSVReader
+ * Suporta arquivo simples, gzip (compilar com -DUSE_ZLIB -lz)
+ * e zstd (compilar com -DUSE_ZSTD -lzstd)
+ */
+class InputSource
+{
+public:
+    virtual ~InputSource() = default;
+
+    /**
+     * Lê até capacity bytes já descomprimidos
+     * @param buffer Destino dos bytes
+     * @param capacity Tamanho do destino
+     * @return Número de bytes lidos (0 = fim dos dados)
+     */
+    virtual size_t read(char *buffer, size_t capacity) = 0;
+
+    virtual std::string getType() const = 0;
+};
+
+/**
+ * Cria a fonte adequada pela extensão do arquivo (.gz, .zst ou simples)
+ * Lança std::runtime_error se o arquivo não abrir ou o formato não foi compilado
+ * @param filename Caminho do arquivo
+ * @return Fonte pronta para leitura
+ */
+std::unique_ptr<InputSource> createInputSource(const std::string &filename);
+
+/**
+ * Verifica se o arquivo tem extensão de formato comprimido
+ * @param filename Caminho do arquivo
+ * @return true para .gz ou .zst
+ */
+bool isCompressedFile(const std::string &filename);
+
+#endif // INPUTSOURCE_HPP
@@ -0,0 +1,108 @@
+#ifndef LINKEDSORT_HPP
+#define LINKEDSORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Ordenação por distribuição que religa os nós de uma lista encadeada
+ * Cada passada percorre a cadeia uma vez, pendura cada nó no fim do balde
+ * do seu dígito (estável) e concatena os baldes. Com amplitude menor que
+ * BUCKETS é um counting sort de uma passada; acima disso vira radix LSD.
+ * Nenhuma alocação (baldes na pilha) e nenhum valor é copiado.
+ * Requer nós com campos 'data' (int) e 'next'.
+ */
+class LinkedSort
+{
+public:
+    static constexpr unsigned RADIX_BITS = 11;
+    static constexpr size_t BUCKETS = size_t(1) << RADIX_BITS;
+
+    /**
+     * Ordena a cadeia em ordem crescente
+     * @param head Primeiro nó; atualizado para o novo primeiro
+     * @param tail Atualizado para o novo último nó
+     */
+    template <typename Node>
+    static void sort(Node *&head, Node *&tail)
+    {
+        if (head == nullptr || head->next == nullptr)
+        {
+            return;
+        }
+
+        int minVal = head->data;
+        int maxVal = head->data;
+        for (Node *node = head->next; node != nullptr; node = node->next)
+        {
+            minVal = std::min(minVal, node->data);
+            maxVal = std::max(maxVal, node->data);
+        }
+
+        // Chaves deslocadas pelo mínimo: só as passadas com bits úteis são feitas
+        const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(maxVal) - minVal);
+        Node *bucketHead[BUCKETS];
+        Node *bucketTail[BUCKETS];
+
+        for (unsigned shift = 0; shift < 32 && (range >> shift) != 0; shift += RADIX_BITS)
+        {
+            std::fill(bucketHead, bucketHead + BUCKETS, nullptr);
+
+            for (Node *node = head; node != nullptr; node = node->next)
+            {
+                uint32_t key = static_cast<uint32_t>(static_cast<int64_t>(node->data) - minVal);
+                size_t digit = (key >> shift) & (BUCKETS - 1);
+                if (bucketHead[digit] == nullptr)
+                {
+                    bucketHead[digit] = node;
+                }
+                else
+                {
+                    bucketTail[digit]->next = node;
+                }
+                bucketTail[digit] = node;
+            }
+
+            Node *last = nullptr;
+            for (size_t digit = 0; digit < BUCKETS; ++digit)
+            {
+                if (bucketHead[digit] == nullptr)
+                {
+                    continue;
+                }
+                if (last == nullptr)
+                {
+                    head = bucketHead[digit];
+                }
+                else
+                {
+                    last->next = bucketHead[digit];
+                }
+                last = bucketTail[digit];
+            }
+            last->next = nullptr;
+            tail = last;
+        }
+    }
+
+    /**
+     * Inverte a cadeia no lugar
+     * @return Novo primeiro nó (o antigo último)
+     */
+    template <typename Node>
+    static Node *reverse(Node *head)
+    {
+        Node *previous = nullptr;
+        while (head != nullptr)
+        {
+            Node *next = head->next;
+            head->next = previous;
+            previous = head;
+            head = next;
+        }
+        return previous;
+    }
+};
+
+#endif // LINKEDSORT_HPP
@@ -1,6 +1,8 @@
 #include "ListStructure.hpp"
+#include "LinkedSort.hpp"
+#include <algorithm>
 
-ListStructure::ListStructure(bool dynamic) : DataStructure(dynamic)
+ListStructure::ListStructure(bool dynamic, AllocationPolicy policy) : DataStructure(dynamic), nodes(policy)
 {
     if (isDynamic)
     {
@@ -20,13 +22,7 @@ ListStructure::~ListStructure()
 
 void ListStructure::clearDynamicList()
 {
-    Node *current = head;
-    while (current != nullptr)
-    {
-        Node *next = current->next;
-        delete current;
-        current = next;
-    }
+    nodes.releaseChain(head);
     head = nullptr;
     tail = nullptr;
     currentSize = 0;
@@ -36,7 +32,7 @@ void ListStructure::insert(int value)
 {
     if (isDynamic)
     {
-        Node *newNode = new Node(value);
+        Node *newNode = nodes.create(value);
 
         if (head == nullptr)
         {
@@ -71,40 +67,127 @@ void ListStructure::clear()
 std::vector<int> ListStructure::toVector() const
 {
     std::vector<int> result;
+    toVector(result);
+    return result;
+}
+
+void ListStructure::toVector(std::vector<int> &out) const
+{
+    out.resize(size());
 
     if (isDynamic)
     {
-        Node *current = head;
-        while (current != nullptr)
+        int *dest = out.data();
+        for (Node *current = head; current != nullptr; current = current->next)
         {
-            result.push_back(current->data);
-            current = current->next;
+            *dest++ = current->data;
         }
     }
     else
     {
-        for (const auto &value : linearList)
+        std::copy(linearList.begin(), linearList.end(), out.begin());
+    }
+}
+
+void ListStructure::insertBatch(const int *values, size_t count)
+{
+    if (!isDynamic)
+    {
+        linearList.insert(linearList.end(), values, values + count);
+        return;
+    }
+
+    // Reserva os nós do bloco de uma vez; sem despacho virtual por elemento
+    nodes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Node *newNode = nodes.create(values[i]);
+        if (head == nullptr)
+        {
+            head = newNode;
+        }
+        else
         {
-            result.push_back(value);
+            tail->next = newNode;
         }
+        tail = newNode;
     }
-
-    return result;
+    currentSize += count;
 }
 
 void ListStructure::fromVector(const std::vector<int> &vec)
 {
     clear();
+    insertBatch(vec.data(), vec.size());
+}
 
-    for (const auto &value : vec)
+void ListStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    if (isDynamic)
+    {
+        const Node *current = head;
+        visitStaged([&]() -> const int *
+                    {
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+            const int *value = &current->data;
+            current = current->next;
+            return value; },
+                    visitor);
+    }
+    else
+    {
+        auto it = linearList.begin();
+        visitStaged([&]() -> const int *
+                    { return it == linearList.end() ? nullptr : &*it++; },
+                    visitor);
+    }
+}
+
+void ListStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    if (isDynamic)
     {
-        insert(value);
+        Node *current = head;
+        updateStaged([&]() -> int *
+                     {
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+            int *value = &current->data;
+            current = current->next;
+            return value; },
+                     visitor);
+    }
+    else
+    {
+        auto it = linearList.begin();
+        updateStaged([&]() -> int *
+                     { return it == linearList.end() ? nullptr : &*it++; },
+                     visitor);
+    }
+}
+
+bool ListStructure::relinkSort()
+{
+    if (!isDynamic)
+    {
+        return false;
     }
+    LinkedSort::sort(head, tail);
+    return true;
 }
 
 std::string ListStructure::getType() const
 {
-    return isDynamic ? "Dynamic List" : "Linear List";
+    if (!isDynamic)
+    {
+        return "Linear List";
+    }
+    return nodes.getPolicy() == AllocationPolicy::Malloc ? "Dynamic List (malloc)" : "Dynamic List";
 }
 
 size_t ListStructure::size() const
@@ -2,6 +2,7 @@
 #define LISTSTRUCTURE_HPP
 
 #include "DataStructure.hpp"
+#include "NodeArena.hpp"
 #include <list>
 
 class ListStructure : public DataStructure
@@ -17,11 +18,12 @@ private:
     Node *head;
     Node *tail;
     size_t currentSize;
+    NodeArena<Node> nodes;
 
     std::list<int> linearList;
 
 public:
-    explicit ListStructure(bool dynamic = false);
+    explicit ListStructure(bool dynamic = false, AllocationPolicy policy = AllocationPolicy::Arena);
     ~ListStructure() override;
 
     size_t size() const override;
@@ -32,6 +34,13 @@ public:
     void fromVector(const std::vector<int> &vec) override;
     std::string getType() const override;
 
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+    void forEachChunk(const ChunkVisitor &visitor) const override;
+    void updateEachChunk(const MutableChunkVisitor &visitor) override;
+    bool relinkSort() override;
+
 private:
     void clearDynamicList();
 };
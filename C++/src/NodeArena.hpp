@@ -0,0 +1,184 @@
+#ifndef NODEARENA_HPP
+#define NODEARENA_HPP
+
+#include <vector>
+#include <algorithm>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Política de alocação dos nós das estruturas dinâmicas
+ * Malloc: um new/delete por nó (comportamento original)
+ * Arena: nós contíguos em slabs, liberados em bloco no clear()
+ */
+enum class AllocationPolicy
+{
+    Malloc,
+    Arena
+};
+
+/**
+ * Alocador de nós em slabs para List, Queue e Stack dinâmicas
+ * Nós removidos individualmente (pop/dequeue) vão para uma lista livre;
+ * releaseChain() descarta todos de uma vez e mantém os slabs para reuso.
+ */
+template <typename T>
+class NodeArena
+{
+    static_assert(std::is_trivially_destructible<T>::value, "Nós da arena não podem ter destrutor");
+    static_assert(sizeof(T) >= sizeof(void *), "Nó precisa comportar o ponteiro da lista livre");
+
+private:
+    struct Slab
+    {
+        void *memory;
+        size_t capacity;
+    };
+
+    static constexpr size_t FIRST_SLAB_NODES = 256;
+    static constexpr size_t MAX_SLAB_NODES = 1 << 16;
+
+    AllocationPolicy policy;
+    std::vector<Slab> slabs;
+    size_t currentSlab; // Slab em uso
+    size_t used;        // Nós já entregues do slab em uso
+    void *freeList;
+
+public:
+    explicit NodeArena(AllocationPolicy allocationPolicy = AllocationPolicy::Arena)
+        : policy(allocationPolicy), currentSlab(0), used(0), freeList(nullptr) {}
+
+    ~NodeArena()
+    {
+        for (const Slab &slab : slabs)
+        {
+            ::operator delete(slab.memory, std::align_val_t(alignof(T)));
+        }
+    }
+
+    NodeArena(const NodeArena &) = delete;
+    NodeArena &operator=(const NodeArena &) = delete;
+
+    AllocationPolicy getPolicy() const { return policy; }
+
+    template <typename... Args>
+    T *create(Args &&...args)
+    {
+        if (policy == AllocationPolicy::Malloc)
+        {
+            return new T(std::forward<Args>(args)...);
+        }
+
+        void *slot;
+        if (freeList != nullptr)
+        {
+            slot = freeList;
+            freeList = *static_cast<void **>(freeList);
+        }
+        else
+        {
+            slot = nextSlot();
+        }
+        return new (slot) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T *node)
+    {
+        if (policy == AllocationPolicy::Malloc)
+        {
+            delete node;
+            return;
+        }
+
+        *reinterpret_cast<void **>(node) = freeList;
+        freeList = node;
+    }
+
+    /**
+     * Libera uma cadeia de nós ligada por 'next'
+     * Na arena não percorre a cadeia: apenas volta ao início do primeiro slab
+     * @param first Primeiro nó da cadeia (pode ser nullptr)
+     */
+    void releaseChain(T *first)
+    {
+        if (policy == AllocationPolicy::Malloc)
+        {
+            while (first != nullptr)
+            {
+                T *next = first->next;
+                delete first;
+                first = next;
+            }
+            return;
+        }
+
+        currentSlab = 0;
+        used = 0;
+        freeList = nullptr;
+    }
+
+    /**
+     * Reserva slabs suficientes para count nós adicionais
+     */
+    void reserve(size_t count)
+    {
+        if (policy == AllocationPolicy::Malloc)
+        {
+            return;
+        }
+
+        size_t available = slabs.empty() ? 0 : slabs[currentSlab].capacity - used;
+        for (size_t i = currentSlab + 1; i < slabs.size(); ++i)
+        {
+            available += slabs[i].capacity;
+        }
+        while (available < count)
+        {
+            available += addSlab(count - available)->capacity;
+        }
+    }
+
+    // Bytes reservados pelos slabs (0 na política Malloc)
+    size_t reservedBytes() const
+    {
+        size_t total = 0;
+        for (const Slab &slab : slabs)
+        {
+            total += slab.capacity * sizeof(T);
+        }
+        return total;
+    }
+
+private:
+    void *nextSlot()
+    {
+        if (slabs.empty() || used == slabs[currentSlab].capacity)
+        {
+            if (!slabs.empty() && currentSlab + 1 < slabs.size())
+            {
+                currentSlab++;
+            }
+            else
+            {
+                addSlab(0);
+                currentSlab = slabs.size() - 1;
+            }
+            used = 0;
+        }
+        return static_cast<char *>(slabs[currentSlab].memory) + (used++) * sizeof(T);
+    }
+
+    // Slabs crescem em progressão geométrica até MAX_SLAB_NODES
+    Slab *addSlab(size_t minimum)
+    {
+        size_t capacity = slabs.empty() ? FIRST_SLAB_NODES : slabs.back().capacity * 2;
+        capacity = std::max(std::min(capacity, size_t(MAX_SLAB_NODES)), std::min(minimum, size_t(MAX_SLAB_NODES)));
+        void *memory = ::operator new(capacity * sizeof(T), std::align_val_t(alignof(T)));
+        slabs.push_back({memory, capacity});
+        return &slabs.back();
+    }
+};
+
+#endif // NODEARENA_HPP
@@ -0,0 +1,203 @@
+#include "OutputWriter.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    // Grava todo o intervalo a partir de offset, repetindo em escritas parciais
+    void writeAt(int fd, const char *data, size_t size, off_t offset)
+    {
+        while (size > 0)
+        {
+            ssize_t written = ::pwrite(fd, data, size, offset);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error(std::string("Erro ao gravar saída: ") + std::strerror(errno));
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+            offset += written;
+        }
+    }
+
+    inline void storeLittleEndian(char *dest, int value)
+    {
+        uint32_t bits = static_cast<uint32_t>(value);
+        dest[0] = static_cast<char>(bits & 0xFF);
+        dest[1] = static_cast<char>((bits >> 8) & 0xFF);
+        dest[2] = static_cast<char>((bits >> 16) & 0xFF);
+        dest[3] = static_cast<char>((bits >> 24) & 0xFF);
+    }
+
+    // Executa task(begin, end, threadIndex) sobre partes contíguas do vetor;
+    // a exceção de qualquer thread é relançada na chamadora após os joins
+    template <typename Task>
+    void runPartitioned(size_t count, unsigned threads, Task task)
+    {
+        std::vector<std::exception_ptr> errors(threads);
+        size_t perThread = (count + threads - 1) / threads;
+        auto guarded = [&](size_t begin, size_t end, unsigned threadIndex)
+        {
+            try
+            {
+                task(begin, end, threadIndex);
+            }
+            catch (...)
+            {
+                errors[threadIndex] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; ++t)
+        {
+            size_t begin = std::min(count, t * perThread);
+            size_t end = std::min(count, begin + perThread);
+            pool.emplace_back(guarded, begin, end, t);
+        }
+        guarded(0, std::min(count, perThread), 0u);
+
+        for (auto &thread : pool)
+        {
+            thread.join();
+        }
+        for (const auto &error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
+
+size_t OutputWriter::csvLength(int value)
+{
+    // Dígitos + sinal + '\n'
+    int64_t magnitude = value < 0 ? -static_cast<int64_t>(value) : value;
+    size_t length = value < 0 ? 2 : 1;
+    do
+    {
+        length++;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    return length;
+}
+
+size_t OutputWriter::write(const std::string &filename, const std::vector<int> &data, const Options &options)
+{
+    int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Não foi possível criar arquivo " + filename);
+    }
+
+    unsigned threads = options.threads != 0 ? options.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::clamp<size_t>(threads, 1, std::max<size_t>(data.size(), 1)));
+    const size_t bufferSize = std::max<size_t>(options.bufferSize, 64);
+
+    size_t totalBytes = 0;
+    try
+    {
+        if (options.format == Format::Binary)
+        {
+            totalBytes = data.size() * 4;
+            runPartitioned(data.size(), threads, [&](size_t begin, size_t end, unsigned)
+                           {
+                std::vector<char> buffer(std::min(bufferSize, (end - begin) * 4 + 4));
+                size_t perBuffer = buffer.size() / 4;
+                for (size_t i = begin; i < end; i += perBuffer)
+                {
+                    size_t count = std::min(perBuffer, end - i);
+                    for (size_t j = 0; j < count; ++j)
+                    {
+                        storeLittleEndian(buffer.data() + j * 4, data[i + j]);
+                    }
+                    writeAt(fd, buffer.data(), count * 4, static_cast<off_t>(i * 4));
+                } });
+        }
+        else
+        {
+            std::string header = options.csvHeader.empty() ? "" : options.csvHeader + "\n";
+            writeAt(fd, header.data(), header.size(), 0);
+
+            // Passo 1: tamanho em bytes de cada parte para obter offsets disjuntos
+            std::vector<size_t> partBytes(threads, 0);
+            runPartitioned(data.size(), threads, [&](size_t begin, size_t end, unsigned t)
+                           {
+                size_t bytes = 0;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    bytes += csvLength(data[i]);
+                }
+                partBytes[t] = bytes; });
+
+            std::vector<size_t> partOffsets(threads, header.size());
+            for (unsigned t = 1; t < threads; ++t)
+            {
+                partOffsets[t] = partOffsets[t - 1] + partBytes[t - 1];
+            }
+            totalBytes = partOffsets[threads - 1] + partBytes[threads - 1];
+
+            // Passo 2: formata com to_chars em buffer grande e grava no offset da parte
+            runPartitioned(data.size(), threads, [&](size_t begin, size_t end, unsigned t)
+                           {
+                std::vector<char> buffer(bufferSize);
+                char *cursor = buffer.data();
+                char *limit = buffer.data() + buffer.size() - 13; // Pior caso de um int + '\n'
+                size_t offset = partOffsets[t];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    cursor = std::to_chars(cursor, limit + 12, data[i]).ptr;
+                    *cursor++ = '\n';
+                    if (cursor >= limit)
+                    {
+                        size_t used = static_cast<size_t>(cursor - buffer.data());
+                        writeAt(fd, buffer.data(), used, static_cast<off_t>(offset));
+                        offset += used;
+                        cursor = buffer.data();
+                    }
+                }
+                writeAt(fd, buffer.data(), static_cast<size_t>(cursor - buffer.data()), static_cast<off_t>(offset)); });
+        }
+    }
+    catch (...)
+    {
+        ::close(fd);
+        throw;
+    }
+
+    if (::close(fd) != 0)
+    {
+        throw std::runtime_error("Erro ao fechar arquivo " + filename);
+    }
+    return totalBytes;
+}
+
+bool OutputWriter::parseFormat(const std::string &name, Format &format)
+{
+    if (name == "bin")
+    {
+        format = Format::Binary;
+        return true;
+    }
+    if (name == "csv")
+    {
+        format = Format::CSV;
+        return true;
+    }
+    return false;
+}
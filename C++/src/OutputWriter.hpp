@@ -0,0 +1,50 @@
+#ifndef OUTPUTWRITER_HPP
+#define OUTPUTWRITER_HPP
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * Grava colunas ordenadas em disco
+ * Binary: int32 little-endian cru; CSV: um valor por linha via std::to_chars
+ * Com threads > 1 cada thread grava um intervalo disjunto do arquivo (pwrite)
+ */
+class OutputWriter
+{
+public:
+    enum class Format
+    {
+        Binary,
+        CSV
+    };
+
+    struct Options
+    {
+        Format format = Format::Binary;
+        unsigned threads = 1;      // 0 = std::thread::hardware_concurrency()
+        size_t bufferSize = 4 << 20; // Bytes formatados por chamada de escrita
+        std::string csvHeader;     // Primeira linha do CSV (vazia = sem cabeçalho)
+    };
+
+    /**
+     * Grava o vetor no arquivo, substituindo o conteúdo anterior
+     * Lança std::runtime_error se o arquivo não puder ser criado ou gravado
+     * @param filename Caminho de saída
+     * @param data Valores a gravar
+     * @param options Formato, paralelismo e tamanho do buffer
+     * @return Número de bytes gravados
+     */
+    static size_t write(const std::string &filename, const std::vector<int> &data, const Options &options);
+
+    /**
+     * Converte "bin"/"csv" no formato correspondente
+     * @return false se o nome não for reconhecido
+     */
+    static bool parseFormat(const std::string &name, Format &format);
+
+private:
+    static size_t csvLength(int value);
+};
+
+#endif // OUTPUTWRITER_HPP
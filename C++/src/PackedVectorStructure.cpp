@@ -0,0 +1,470 @@
+#include "PackedVectorStructure.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    uint64_t maxCode(unsigned width)
+    {
+        return width == 32 ? 0xFFFFFFFFull : (uint64_t(1) << width) - 1;
+    }
+
+    // Menor largura suportada que representa códigos 0..range
+    unsigned widthFor(uint64_t range)
+    {
+        unsigned width = 1;
+        while (width < 32 && range > maxCode(width))
+        {
+            width *= 2;
+        }
+        return width;
+    }
+
+    size_t bytesFor(size_t count, unsigned width)
+    {
+        return (count * width + 7) / 8;
+    }
+
+    uint32_t getCode(const uint8_t *src, unsigned width, size_t index)
+    {
+        if (width < 8)
+        {
+            size_t bit = index * width;
+            return (src[bit / 8] >> (bit % 8)) & static_cast<uint32_t>(maxCode(width));
+        }
+        if (width == 8)
+        {
+            return src[index];
+        }
+        if (width == 16)
+        {
+            uint16_t code;
+            std::memcpy(&code, src + index * 2, sizeof(code));
+            return code;
+        }
+        uint32_t code;
+        std::memcpy(&code, src + index * 4, sizeof(code));
+        return code;
+    }
+
+    void setCode(uint8_t *dst, unsigned width, size_t index, uint32_t code)
+    {
+        if (width < 8)
+        {
+            size_t bit = index * width;
+            uint8_t mask = static_cast<uint8_t>(maxCode(width) << (bit % 8));
+            dst[bit / 8] = static_cast<uint8_t>((dst[bit / 8] & ~mask) | (code << (bit % 8)));
+        }
+        else if (width == 8)
+        {
+            dst[index] = static_cast<uint8_t>(code);
+        }
+        else if (width == 16)
+        {
+            uint16_t narrow = static_cast<uint16_t>(code);
+            std::memcpy(dst + index * 2, &narrow, sizeof(narrow));
+        }
+        else
+        {
+            std::memcpy(dst + index * 4, &code, sizeof(code));
+        }
+    }
+
+    // Códigos = valor - base; a subtração em 32 bits com estouro dá o mesmo código
+    void packCodes(uint8_t *dst, unsigned width, int64_t base, size_t first, const int *values, size_t length)
+    {
+        uint32_t base32 = static_cast<uint32_t>(base);
+        size_t i = 0;
+
+#if defined(__SSE2__)
+        const __m128i bias = _mm_set1_epi32(static_cast<int>(base32));
+        if (width == 4)
+        {
+            if ((first & 1) != 0 && length > 0)
+            {
+                setCode(dst, width, first, static_cast<uint32_t>(values[0]) - base32);
+                i = 1;
+            }
+            // 32 valores → 16 bytes: int32 → int8 por saturação e junção dos pares em nibbles
+            const __m128i lowByte = _mm_set1_epi16(0x00FF);
+            for (; i + 32 <= length; i += 32)
+            {
+                const __m128i *in = reinterpret_cast<const __m128i *>(values + i);
+                __m128i v0 = _mm_sub_epi32(_mm_loadu_si128(in + 0), bias);
+                __m128i v1 = _mm_sub_epi32(_mm_loadu_si128(in + 1), bias);
+                __m128i v2 = _mm_sub_epi32(_mm_loadu_si128(in + 2), bias);
+                __m128i v3 = _mm_sub_epi32(_mm_loadu_si128(in + 3), bias);
+                __m128i v4 = _mm_sub_epi32(_mm_loadu_si128(in + 4), bias);
+                __m128i v5 = _mm_sub_epi32(_mm_loadu_si128(in + 5), bias);
+                __m128i v6 = _mm_sub_epi32(_mm_loadu_si128(in + 6), bias);
+                __m128i v7 = _mm_sub_epi32(_mm_loadu_si128(in + 7), bias);
+                __m128i x = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+                __m128i y = _mm_packus_epi16(_mm_packs_epi32(v4, v5), _mm_packs_epi32(v6, v7));
+                // Cada palavra de 16 bits = par | ímpar << 8 → par | ímpar << 4
+                x = _mm_and_si128(_mm_or_si128(x, _mm_srli_epi16(x, 4)), lowByte);
+                y = _mm_and_si128(_mm_or_si128(y, _mm_srli_epi16(y, 4)), lowByte);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + (first + i) / 2), _mm_packus_epi16(x, y));
+            }
+        }
+        else if (width == 8)
+        {
+            for (; i + 16 <= length; i += 16)
+            {
+                const __m128i *in = reinterpret_cast<const __m128i *>(values + i);
+                __m128i v0 = _mm_sub_epi32(_mm_loadu_si128(in + 0), bias);
+                __m128i v1 = _mm_sub_epi32(_mm_loadu_si128(in + 1), bias);
+                __m128i v2 = _mm_sub_epi32(_mm_loadu_si128(in + 2), bias);
+                __m128i v3 = _mm_sub_epi32(_mm_loadu_si128(in + 3), bias);
+                __m128i packed = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + first + i), packed);
+            }
+        }
+#endif
+
+        for (; i < length; ++i)
+        {
+            setCode(dst, width, first + i, static_cast<uint32_t>(values[i]) - base32);
+        }
+    }
+
+    void unpackCodes(const uint8_t *src, unsigned width, int64_t base, size_t first, size_t length, int *out)
+    {
+        uint32_t base32 = static_cast<uint32_t>(base);
+        size_t i = 0;
+
+#if defined(__SSE2__)
+        const __m128i bias = _mm_set1_epi32(static_cast<int>(base32));
+        const __m128i zero = _mm_setzero_si128();
+        if (width == 4)
+        {
+            if ((first & 1) != 0 && length > 0)
+            {
+                out[0] = static_cast<int>(getCode(src, width, first) + base32);
+                i = 1;
+            }
+            // 16 bytes → 32 valores: separa nibbles baixos/altos e intercala
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            for (; i + 32 <= length; i += 32)
+            {
+                __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (first + i) / 2));
+                __m128i low = _mm_and_si128(packed, nibble);
+                __m128i high = _mm_and_si128(_mm_srli_epi16(packed, 4), nibble);
+                __m128i halves[2] = {_mm_unpacklo_epi8(low, high), _mm_unpackhi_epi8(low, high)};
+                __m128i *dest = reinterpret_cast<__m128i *>(out + i);
+                for (int h = 0; h < 2; ++h)
+                {
+                    __m128i words0 = _mm_unpacklo_epi8(halves[h], zero);
+                    __m128i words1 = _mm_unpackhi_epi8(halves[h], zero);
+                    _mm_storeu_si128(dest++, _mm_add_epi32(_mm_unpacklo_epi16(words0, zero), bias));
+                    _mm_storeu_si128(dest++, _mm_add_epi32(_mm_unpackhi_epi16(words0, zero), bias));
+                    _mm_storeu_si128(dest++, _mm_add_epi32(_mm_unpacklo_epi16(words1, zero), bias));
+                    _mm_storeu_si128(dest++, _mm_add_epi32(_mm_unpackhi_epi16(words1, zero), bias));
+                }
+            }
+        }
+        else if (width == 8)
+        {
+            for (; i + 16 <= length; i += 16)
+            {
+                __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + first + i));
+                __m128i words0 = _mm_unpacklo_epi8(packed, zero);
+                __m128i words1 = _mm_unpackhi_epi8(packed, zero);
+                __m128i *dest = reinterpret_cast<__m128i *>(out + i);
+                _mm_storeu_si128(dest + 0, _mm_add_epi32(_mm_unpacklo_epi16(words0, zero), bias));
+                _mm_storeu_si128(dest + 1, _mm_add_epi32(_mm_unpackhi_epi16(words0, zero), bias));
+                _mm_storeu_si128(dest + 2, _mm_add_epi32(_mm_unpacklo_epi16(words1, zero), bias));
+                _mm_storeu_si128(dest + 3, _mm_add_epi32(_mm_unpackhi_epi16(words1, zero), bias));
+            }
+        }
+#endif
+
+        for (; i < length; ++i)
+        {
+            out[i] = static_cast<int>(getCode(src, width, first + i) + base32);
+        }
+    }
+}
+
+PackedVectorStructure::PackedVectorStructure()
+    : DataStructure(true), count(0), base(0), minValue(0), maxValue(0), bitWidth(1)
+{
+}
+
+void PackedVectorStructure::ensureRange(int low, int high)
+{
+    if (count == 0)
+    {
+        base = low;
+        minValue = low;
+        maxValue = high;
+        bitWidth = widthFor(static_cast<uint64_t>(int64_t(high) - low));
+        return;
+    }
+
+    int newLow = std::min(minValue, low);
+    int newHigh = std::max(maxValue, high);
+    if (newLow >= base && static_cast<uint64_t>(newHigh - base) <= maxCode(bitWidth))
+    {
+        minValue = newLow;
+        maxValue = newHigh;
+        return;
+    }
+
+    // Ao crescer para baixo a base vai o mais longe possível, ao crescer para
+    // cima fica no mínimo: sequências monotônicas só recodificam ao trocar de largura
+    unsigned newWidth = std::max(bitWidth, widthFor(static_cast<uint64_t>(int64_t(newHigh) - newLow)));
+    int64_t newBase = newLow;
+    if (low < base)
+    {
+        newBase = std::max<int64_t>(newHigh - static_cast<int64_t>(maxCode(newWidth)), INT_MIN);
+    }
+    repack(newWidth, newBase);
+    minValue = newLow;
+    maxValue = newHigh;
+}
+
+void PackedVectorStructure::repack(unsigned newWidth, int64_t newBase)
+{
+    std::vector<uint8_t> packed(bytesFor(count, newWidth));
+    int stage[STAGE_SIZE];
+    for (size_t first = 0; first < count; first += STAGE_SIZE)
+    {
+        size_t length = std::min(STAGE_SIZE, count - first);
+        unpackCodes(bytes.data(), bitWidth, base, first, length, stage);
+        packCodes(packed.data(), newWidth, newBase, first, stage, length);
+    }
+
+    bytes.swap(packed);
+    bitWidth = newWidth;
+    base = newBase;
+}
+
+void PackedVectorStructure::insert(int value)
+{
+    if (count == 0 || value < minValue || value > maxValue)
+    {
+        ensureRange(value, value);
+    }
+
+    size_t needed = bytesFor(count + 1, bitWidth);
+    if (needed > bytes.size())
+    {
+        bytes.resize(needed);
+    }
+    setCode(bytes.data(), bitWidth, count, static_cast<uint32_t>(value) - static_cast<uint32_t>(base));
+    count++;
+}
+
+void PackedVectorStructure::insertBatch(const int *values, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    auto range = std::minmax_element(values, values + length);
+    ensureRange(*range.first, *range.second);
+
+    bytes.resize(bytesFor(count + length, bitWidth));
+    packCodes(bytes.data(), bitWidth, base, count, values, length);
+    count += length;
+}
+
+void PackedVectorStructure::clear()
+{
+    bytes.clear();
+    count = 0;
+    base = 0;
+    minValue = maxValue = 0;
+    bitWidth = 1;
+}
+
+void PackedVectorStructure::unpack(size_t first, size_t length, int *out) const
+{
+    unpackCodes(bytes.data(), bitWidth, base, first, length, out);
+}
+
+std::vector<int> PackedVectorStructure::toVector() const
+{
+    std::vector<int> result;
+    toVector(result);
+    return result;
+}
+
+void PackedVectorStructure::toVector(std::vector<int> &out) const
+{
+    out.resize(count);
+    unpack(0, count, out.data());
+}
+
+void PackedVectorStructure::fromVector(const std::vector<int> &vec)
+{
+    clear();
+    insertBatch(vec.data(), vec.size());
+}
+
+void PackedVectorStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    int stage[STAGE_SIZE];
+    for (size_t first = 0; first < count; first += STAGE_SIZE)
+    {
+        size_t length = std::min(STAGE_SIZE, count - first);
+        unpack(first, length, stage);
+        visitor(stage, length);
+    }
+}
+
+void PackedVectorStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    int stage[STAGE_SIZE];
+    for (size_t first = 0; first < count; first += STAGE_SIZE)
+    {
+        size_t length = std::min(STAGE_SIZE, count - first);
+        unpack(first, length, stage);
+        visitor(stage, length);
+
+        // O visitante pode ter gravado valores fora do intervalo atual
+        auto range = std::minmax_element(stage, stage + length);
+        ensureRange(*range.first, *range.second);
+        packCodes(bytes.data(), bitWidth, base, first, stage, length);
+    }
+}
+
+uint64_t PackedVectorStructure::firstHistogramCode() const
+{
+    // Em 32 bits a base pode ter descido até INT_MIN ao crescer para baixo:
+    // o histograma cobre só [minValue, maxValue], nunca [base, maxValue]
+    return bitWidth <= 16 ? 0 : static_cast<uint64_t>(int64_t(minValue) - base);
+}
+
+void PackedVectorStructure::countCodes(std::vector<size_t> &counts) const
+{
+    uint64_t codes = bitWidth <= 16 ? maxCode(bitWidth) + 1
+                                    : static_cast<uint64_t>(int64_t(maxValue) - minValue) + 1;
+    counts.assign(codes, 0);
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t i = 0;
+    if (bitWidth <= 8)
+    {
+        // Histograma de bytes inteiros (quatro tabelas para não serializar
+        // incrementos no mesmo contador) e depois dos campos de cada byte
+        size_t perByte = 8 / bitWidth;
+        size_t fullBytes = count / perByte;
+        std::vector<size_t> byteCounts(4 * 256, 0);
+        size_t b = 0;
+        for (; b + 4 <= fullBytes; b += 4)
+        {
+            byteCounts[bytes[b]]++;
+            byteCounts[256 + bytes[b + 1]]++;
+            byteCounts[512 + bytes[b + 2]]++;
+            byteCounts[768 + bytes[b + 3]]++;
+        }
+        for (; b < fullBytes; ++b)
+        {
+            byteCounts[bytes[b]]++;
+        }
+
+        uint32_t mask = static_cast<uint32_t>(maxCode(bitWidth));
+        for (uint32_t value = 0; value < 256; ++value)
+        {
+            size_t occurrences = byteCounts[value] + byteCounts[256 + value] +
+                                 byteCounts[512 + value] + byteCounts[768 + value];
+            if (occurrences == 0)
+            {
+                continue;
+            }
+            for (unsigned field = 0; field < 8; field += bitWidth)
+            {
+                counts[(value >> field) & mask] += occurrences;
+            }
+        }
+        i = fullBytes * perByte;
+    }
+
+    const uint64_t first = firstHistogramCode();
+    for (; i < count; ++i)
+    {
+        counts[getCode(bytes.data(), bitWidth, i) - first]++;
+    }
+}
+
+void PackedVectorStructure::assignSortedCodes(const std::vector<size_t> &counts)
+{
+    const uint64_t first = firstHistogramCode();
+    size_t position = 0;
+    for (size_t code = 0; code < counts.size() && position < count; ++code)
+    {
+        size_t remaining = std::min(counts[code], count - position);
+        if (remaining == 0)
+        {
+            continue;
+        }
+
+        if (bitWidth <= 8)
+        {
+            // Completa o byte parcial, preenche bytes inteiros com o código
+            // replicado e termina o trecho campo a campo
+            size_t perByte = 8 / bitWidth;
+            while (remaining > 0 && position % perByte != 0)
+            {
+                setCode(bytes.data(), bitWidth, position++, static_cast<uint32_t>(code));
+                remaining--;
+            }
+
+            uint8_t pattern = 0;
+            for (unsigned field = 0; field < 8; field += bitWidth)
+            {
+                pattern = static_cast<uint8_t>(pattern | (code << field));
+            }
+            size_t fullBytes = remaining / perByte;
+            std::memset(bytes.data() + position / perByte, pattern, fullBytes);
+            position += fullBytes * perByte;
+            remaining -= fullBytes * perByte;
+        }
+
+        while (remaining > 0)
+        {
+            setCode(bytes.data(), bitWidth, position++, static_cast<uint32_t>(code + first));
+            remaining--;
+        }
+    }
+}
+
+std::string PackedVectorStructure::getType() const
+{
+    return "Packed Vector";
+}
+
+size_t PackedVectorStructure::size() const
+{
+    return count;
+}
+
+bool PackedVectorStructure::empty() const
+{
+    return count == 0;
+}
+
+unsigned PackedVectorStructure::getBitWidth() const
+{
+    return bitWidth;
+}
+
+int64_t PackedVectorStructure::getBase() const
+{
+    return base;
+}
+
+size_t PackedVectorStructure::getPackedBytes() const
+{
+    return bytesFor(count, bitWidth);
+}
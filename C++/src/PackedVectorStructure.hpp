@@ -0,0 +1,78 @@
+#ifndef PACKEDVECTORSTRUCTURE_HPP
+#define PACKEDVECTORSTRUCTURE_HPP
+
+#include "DataStructure.hpp"
+#include <cstdint>
+
+/**
+ * Vetor compactado por largura de bits
+ * Cada valor é guardado como código (valor - base) com a menor largura em
+ * {1, 2, 4, 8, 16, 32} bits que cobre o intervalo observado; ratings 1..10
+ * ocupam 4 bits (dois por byte). Valores fora do intervalo atual recodificam
+ * o conteúdo com uma largura maior ou uma nova base.
+ *
+ * Larguras de 4 e 8 bits são empacotadas/desempacotadas com SSE2 quando
+ * disponível. CountingSort lê o histograma direto dos bytes compactados
+ * (countCodes) e regrava a sequência ordenada sem desempacotar (assignSortedCodes).
+ */
+class PackedVectorStructure : public DataStructure
+{
+private:
+    std::vector<uint8_t> bytes;
+    size_t count;
+    int64_t base;      // Valor representado pelo código 0
+    int minValue;
+    int maxValue;
+    unsigned bitWidth; // 1, 2, 4, 8, 16 ou 32
+
+public:
+    PackedVectorStructure();
+
+    void insert(int value) override;
+    void clear() override;
+    std::vector<int> toVector() const override;
+    void fromVector(const std::vector<int> &vec) override;
+    std::string getType() const override;
+
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+    void forEachChunk(const ChunkVisitor &visitor) const override;
+    void updateEachChunk(const MutableChunkVisitor &visitor) override;
+
+    size_t size() const override;
+    bool empty() const override;
+
+    unsigned getBitWidth() const;
+    int64_t getBase() const;
+
+    // Bytes efetivamente ocupados pelos códigos
+    size_t getPackedBytes() const;
+
+    /**
+     * Desempacota os valores [first, first + length) em out
+     */
+    void unpack(size_t first, size_t length, int *out) const;
+
+    /**
+     * Histograma dos códigos (valor - getBase()), lido dos bytes compactados
+     * Em 32 bits cobre só os valores presentes: counts[0] é o menor valor
+     * @param counts Recebe counts[código - primeiro código] = ocorrências
+     */
+    void countCodes(std::vector<size_t> &counts) const;
+
+    /**
+     * Regrava o conteúdo como a sequência ordenada descrita pelo histograma,
+     * preenchendo bytes inteiros de uma vez (a soma de counts deve ser size())
+     * @param counts Ocorrências por código, como produzido por countCodes
+     */
+    void assignSortedCodes(const std::vector<size_t> &counts);
+
+private:
+    void ensureRange(int low, int high);
+    // Código que counts[0] representa em countCodes/assignSortedCodes
+    uint64_t firstHistogramCode() const;
+    void repack(unsigned newWidth, int64_t newBase);
+};
+
+#endif // PACKEDVECTORSTRUCTURE_HPP
@@ -0,0 +1,238 @@
+#include "PerfCounters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#endif
+
+namespace
+{
+#if defined(__linux__)
+    uint64_t cacheConfig(uint64_t cache, uint64_t operation, uint64_t result)
+    {
+        return cache | (operation << 8) | (result << 16);
+    }
+
+    // groupFd = -1 abre o líder (desligado); os membros seguem o estado dele
+    int openEvent(uint32_t type, uint64_t config, int groupFd)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = groupFd < 0 ? 1 : 0;
+        // Só espaço de usuário: permitido com perf_event_paranoid <= 2
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                           PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        long fd = syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+        return static_cast<int>(fd);
+    }
+#endif
+}
+
+double PerfCounters::Sample::ipc() const
+{
+    if (!available[Cycles] || !available[Instructions] || values[Cycles] == 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(values[Instructions]) / values[Cycles];
+}
+
+double PerfCounters::Sample::perElement(Event event, size_t elements) const
+{
+    if (!available[event] || elements == 0)
+    {
+        return -1.0;
+    }
+    return static_cast<double>(values[event]) / elements;
+}
+
+bool PerfCounters::Sample::any() const
+{
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        if (available[event])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+PerfCounters::PerfCounters() : leader(-1), running(false)
+{
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        descriptors[event] = -1;
+        ids[event] = 0;
+    }
+
+#if defined(__linux__)
+    const struct
+    {
+        uint32_t type;
+        uint64_t config;
+    } events[EVENT_COUNT] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                                         PERF_COUNT_HW_CACHE_RESULT_MISS)},
+        {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+                                         PERF_COUNT_HW_CACHE_RESULT_MISS)},
+        {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ,
+                                         PERF_COUNT_HW_CACHE_RESULT_MISS)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    };
+
+    // O primeiro evento aberto (Cycles, quando existe) lidera o grupo; um
+    // membro que não cabe junto na PMU é recusado na abertura e fica de fora
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        int fd = openEvent(events[event].type, events[event].config, leader);
+        if (fd < 0)
+        {
+            continue;
+        }
+        if (ioctl(fd, PERF_EVENT_IOC_ID, &ids[event]) != 0)
+        {
+            close(fd);
+            continue;
+        }
+        descriptors[event] = fd;
+        if (leader < 0)
+        {
+            leader = fd;
+        }
+    }
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#if defined(__linux__)
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        if (descriptors[event] >= 0)
+        {
+            close(descriptors[event]);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::available() const
+{
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        if (descriptors[event] >= 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::start()
+{
+#if defined(__linux__)
+    if (leader >= 0)
+    {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+    running = true;
+}
+
+PerfCounters::Sample PerfCounters::stop()
+{
+    Sample sample = emptySample();
+    if (!running)
+    {
+        return sample;
+    }
+    running = false;
+
+#if defined(__linux__)
+    if (leader < 0)
+    {
+        return sample;
+    }
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // nr, time_enabled, time_running e um par (value, id) por membro
+    uint64_t data[3 + 2 * EVENT_COUNT];
+    ssize_t bytes = read(leader, data, sizeof(data));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t)))
+    {
+        return sample;
+    }
+    uint64_t members = std::min<uint64_t>(data[0], EVENT_COUNT);
+    uint64_t timeEnabled = data[1];
+    uint64_t timeRunning = data[2];
+    // Nunca agendado (contadores esgotados): sem valor confiável
+    if (timeRunning == 0 || static_cast<size_t>(bytes) < (3 + 2 * members) * sizeof(uint64_t))
+    {
+        return sample;
+    }
+
+    for (uint64_t member = 0; member < members; ++member)
+    {
+        uint64_t value = data[3 + 2 * member];
+        uint64_t id = data[4 + 2 * member];
+        for (int event = 0; event < EVENT_COUNT; ++event)
+        {
+            if (descriptors[event] >= 0 && ids[event] == id)
+            {
+                sample.values[event] = timeRunning < timeEnabled
+                                           ? static_cast<uint64_t>(static_cast<double>(value) * timeEnabled / timeRunning)
+                                           : value;
+                sample.available[event] = true;
+                break;
+            }
+        }
+    }
+#endif
+    return sample;
+}
+
+PerfCounters::Sample PerfCounters::emptySample()
+{
+    Sample sample;
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        sample.values[event] = 0;
+        sample.available[event] = false;
+    }
+    return sample;
+}
+
+const char *PerfCounters::eventName(Event event)
+{
+    switch (event)
+    {
+    case Cycles:
+        return "cycles";
+    case Instructions:
+        return "instructions";
+    case L1DMisses:
+        return "L1d-misses";
+    case LLCMisses:
+        return "LLC-misses";
+    case DTLBMisses:
+        return "dTLB-misses";
+    case BranchMisses:
+        return "branch-misses";
+    default:
+        return "?";
+    }
+}
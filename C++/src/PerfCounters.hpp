@@ -0,0 +1,80 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Contadores de hardware por fase via perf_event_open (Linux)
+ * Os eventos formam um grupo liderado por Cycles (ou pelo primeiro que
+ * abrir): são zerados, ligados, desligados e lidos juntos, então IPC e as
+ * razões por elemento comparam contagens do mesmo intervalo. Os que o
+ * kernel ou a CPU não oferecem (perf_event_paranoid, máquina virtual sem
+ * PMU, outro SO) ficam marcados como indisponíveis e os demais continuam
+ * sendo medidos. Só o espaço de usuário da thread atual é contado; com
+ * multiplexação o grupo inteiro é escalado por tempo habilitado / tempo em execução.
+ */
+class PerfCounters
+{
+public:
+    enum Event
+    {
+        Cycles,
+        Instructions,
+        L1DMisses,    // Falhas de leitura na L1 de dados
+        LLCMisses,    // Falhas de leitura no último nível de cache
+        DTLBMisses,   // Falhas de leitura na dTLB
+        BranchMisses, // Desvios mal previstos
+        EVENT_COUNT
+    };
+
+    struct Sample
+    {
+        uint64_t values[EVENT_COUNT];
+        bool available[EVENT_COUNT];
+
+        // Instruções por ciclo; 0 se algum dos dois não foi medido
+        double ipc() const;
+
+        /**
+         * Eventos por elemento processado
+         * @return -1 se o evento não foi medido
+         */
+        double perElement(Event event, size_t elements) const;
+
+        bool any() const;
+    };
+
+private:
+    int descriptors[EVENT_COUNT];
+    uint64_t ids[EVENT_COUNT]; // Identificam cada evento na leitura do grupo
+    int leader;                // Descritor do líder do grupo; -1 se nenhum abriu
+    bool running;
+
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    // true se ao menos um evento pôde ser aberto
+    bool available() const;
+
+    /**
+     * Zera e habilita o grupo de contadores abertos
+     */
+    void start();
+
+    /**
+     * Desabilita o grupo e lê, numa única chamada, os contadores desde o último start()
+     */
+    Sample stop();
+
+    // Amostra vazia, com todos os eventos indisponíveis
+    static Sample emptySample();
+
+    static const char *eventName(Event event);
+};
+
+#endif // PERFCOUNTERS_HPP
@@ -3,15 +3,39 @@
 #include "ListStructure.hpp"
 #include "QueueStructure.hpp"
 #include "StackStructure.hpp"
+#include "UnrolledListStructure.hpp"
+#include "PackedVectorStructure.hpp"
+#include "CompressedSortedSequence.hpp"
+#include "ConcurrentQueueStructure.hpp"
+#include "ConcurrentStackStructure.hpp"
 #include "CountingSort.hpp"
+#include "BenchmarkClock.hpp"
 #include <iostream>
 #include <iomanip>
 #include <fstream>
 #include <algorithm>
 #include <random>
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <exception>
 
-PerformanceAnalyzer::PerformanceAnalyzer()
+namespace
+{
+    // Repassa, depois do join, a primeira exceção capturada pelas threads
+    void rethrowFirst(const std::vector<std::exception_ptr> &errors)
+    {
+        for (const auto &error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
+
+PerformanceAnalyzer::PerformanceAnalyzer() : sortMode(SortMode::Copy), compressOutput(false)
 {
     testSizes = {100, 1000, 10000, 100000, 1000000};
 }
@@ -21,53 +45,153 @@ PerformanceAnalyzer::PerformanceResult PerformanceAnalyzer::runPerformanceTest(
     std::unique_ptr<DataStructure> &structure,
     size_t dataSize)
 {
+    BenchmarkContext context;
+    return runPerformanceTest(ratings, structure, dataSize, context);
+}
 
+PerformanceAnalyzer::PerformanceResult PerformanceAnalyzer::runPerformanceTest(
+    const std::vector<int> &ratings,
+    std::unique_ptr<DataStructure> &structure,
+    size_t dataSize,
+    BenchmarkContext &context)
+{
     PerformanceResult result;
     result.structureType = structure->getType();
     result.dataSize = dataSize;
+    result.outputTime = std::chrono::nanoseconds(0);
+    result.outputBytes = 0;
+    result.compressTime = std::chrono::nanoseconds(0);
+    result.compressedBytes = 0;
+    result.loadMemory = result.convertMemory = result.sortMemory = result.convertBackMemory = {0, 0, 0};
+    result.loadCounters = result.convertCounters = result.sortCounters = result.convertBackCounters =
+        PerfCounters::emptySample();
+    result.memoryUsage = 0;
+    result.timerOverhead = BenchmarkClock::overhead();
+    result.warm = context.isWarm();
     result.success = false;
 
+    // Contadores ligados fora da região cronometrada de cada fase
+    auto startCounters = [this]()
+    {
+        if (counters)
+        {
+            counters->start();
+        }
+    };
+    auto stopCounters = [this]()
+    {
+        return counters ? counters->stop() : PerfCounters::emptySample();
+    };
+
     try
     {
-        std::vector<int> testData(ratings.begin(),
-                                  ratings.begin() + std::min(dataSize, ratings.size()));
+        const std::vector<int> &testData = context.loadInput(ratings, dataSize);
 
         structure->clear();
 
-        auto startLoad = std::chrono::high_resolution_clock::now();
+        AllocationTracker::Phase loadPhase;
+        startCounters();
+        uint64_t startLoad = BenchmarkClock::now();
         for (const auto &rating : testData)
         {
             structure->insert(rating);
         }
-        auto endLoad = std::chrono::high_resolution_clock::now();
-        result.loadTime = std::chrono::duration_cast<std::chrono::milliseconds>(endLoad - startLoad);
-
-        auto startConvert = std::chrono::high_resolution_clock::now();
-        std::vector<int> vectorData = structure->toVector();
-        auto endConvert = std::chrono::high_resolution_clock::now();
-        result.convertToVectorTime = std::chrono::duration_cast<std::chrono::milliseconds>(endConvert - startConvert);
+        uint64_t endLoad = BenchmarkClock::now();
+        result.loadCounters = stopCounters();
+        result.loadMemory = loadPhase.finish();
+        result.loadTime = BenchmarkClock::elapsed(startLoad, endLoad);
 
-        std::chrono::milliseconds sortTime;
-        std::vector<int> sortedData = CountingSort::sortWithTiming(vectorData, sortTime);
-        result.sortTime = sortTime;
+        // Fim da última fase; endToEndTime vai de startLoad até aqui
+        uint64_t endPhases;
 
-        auto startConvertBack = std::chrono::high_resolution_clock::now();
-        structure->fromVector(sortedData);
-        auto endConvertBack = std::chrono::high_resolution_clock::now();
-        result.convertBackTime = std::chrono::duration_cast<std::chrono::milliseconds>(endConvertBack - startConvertBack);
+        std::vector<int> &sortedData = context.output();
+        if (sortMode != SortMode::Copy)
+        {
+            result.convertToVectorTime = std::chrono::nanoseconds(0);
+            AllocationTracker::Phase sortPhase;
+            startCounters();
+            CountingSort::sortInPlaceWithTiming(*structure, result.sortTime, sortMode == SortMode::Relink);
+            endPhases = BenchmarkClock::now();
+            result.sortCounters = stopCounters();
+            result.sortMemory = sortPhase.finish();
+            result.convertBackTime = std::chrono::nanoseconds(0);
+
+            if (!outputFile.empty())
+            {
+                structure->toVector(sortedData);
+            }
+        }
+        else
+        {
+            std::vector<int> &vectorData = context.converted();
+            AllocationTracker::Phase convertPhase;
+            startCounters();
+            uint64_t startConvert = BenchmarkClock::now();
+            structure->toVector(vectorData);
+            uint64_t endConvert = BenchmarkClock::now();
+            result.convertCounters = stopCounters();
+            result.convertMemory = convertPhase.finish();
+            result.convertToVectorTime = BenchmarkClock::elapsed(startConvert, endConvert);
+
+            AllocationTracker::Phase sortPhase;
+            startCounters();
+            uint64_t startSort = BenchmarkClock::now();
+            CountingSort::sortInto(vectorData, sortedData, context.scratch());
+            uint64_t endSort = BenchmarkClock::now();
+            result.sortCounters = stopCounters();
+            result.sortMemory = sortPhase.finish();
+            result.sortTime = BenchmarkClock::elapsed(startSort, endSort);
+
+            AllocationTracker::Phase convertBackPhase;
+            startCounters();
+            uint64_t startConvertBack = BenchmarkClock::now();
+            structure->fromVector(sortedData);
+            endPhases = BenchmarkClock::now();
+            result.convertBackCounters = stopCounters();
+            result.convertBackMemory = convertBackPhase.finish();
+            result.convertBackTime = BenchmarkClock::elapsed(startConvertBack, endPhases);
+        }
 
-        result.totalTime = result.convertToVectorTime +
+        // Soma das fases, incluindo a carga
+        result.totalTime = result.loadTime + result.convertToVectorTime +
                            result.sortTime + result.convertBackTime;
+        // Relógio corrido da carga ao fim da última fase: inclui também a
+        // contabilidade de memória e os contadores entre as fases
+        result.endToEndTime = BenchmarkClock::elapsed(startLoad, endPhases);
+
+        if (!outputFile.empty())
+        {
+            uint64_t startOutput = BenchmarkClock::now();
+            result.outputBytes = OutputWriter::write(outputFile, sortedData, outputOptions);
+            uint64_t endOutput = BenchmarkClock::now();
+            result.outputTime = BenchmarkClock::elapsed(startOutput, endOutput);
+        }
+
+        if (compressOutput)
+        {
+            CompressedSortedSequence &sequence = context.compressed();
+            uint64_t startCompress = BenchmarkClock::now();
+            CountingSort::sortCompressed(testData, sequence);
+            uint64_t endCompress = BenchmarkClock::now();
+            result.compressTime = BenchmarkClock::elapsed(startCompress, endCompress);
+            result.compressedBytes = sequence.compressedBytes();
+
+            if (sequence.size() != testData.size())
+            {
+                throw std::runtime_error("sequência compactada com tamanho incorreto");
+            }
+        }
 
-        result.memoryUsage = estimateMemoryUsage(*structure, dataSize);
+        result.memoryUsage = static_cast<size_t>(std::max<int64_t>(result.loadMemory.retainedBytes, 0));
 
+        context.finishRun();
         result.success = true;
     }
     catch (const std::exception &e)
     {
         std::cerr << "Erro durante teste de performance para " << structure->getType()
                   << " com " << dataSize << " elementos: " << e.what() << std::endl;
-        result.success = true;
+        result.success = false;
     }
 
     return result;
@@ -113,6 +237,258 @@ void PerformanceAnalyzer::runFullAnalysis(const std::vector<int> &ratings)
     std::cout << "Análise concluída. Salvando resultados..." << std::endl;
 }
 
+std::vector<PerformanceAnalyzer::ConcurrentInsertResult> PerformanceAnalyzer::runConcurrentInsertTest(
+    const int *ratings, size_t dataSize, unsigned maxProducers, bool batched) const
+{
+    std::vector<ConcurrentInsertResult> concurrentResults;
+    std::vector<int> expected = CountingSort::sort(std::vector<int>(ratings, ratings + dataSize));
+
+    for (unsigned producers = 1; producers <= std::max(maxProducers, 1u); ++producers)
+    {
+        ConcurrentInsertResult result;
+        result.producers = producers;
+        result.dataSize = dataSize;
+        result.success = false;
+
+        ConcurrentQueueStructure queue;
+        std::atomic<bool> start(false);
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(producers);
+        size_t perThread = (dataSize + producers - 1) / producers;
+
+        for (unsigned t = 0; t < producers; ++t)
+        {
+            size_t begin = std::min(dataSize, t * perThread);
+            size_t end = std::min(dataSize, begin + perThread);
+            threads.emplace_back([&, t, begin, end]()
+                                 {
+                while (!start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                try
+                {
+                    if (batched)
+                    {
+                        queue.insertBatch(ratings + begin, end - begin);
+                    }
+                    else
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            queue.insert(ratings[i]);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                } });
+        }
+
+        uint64_t startInsert = BenchmarkClock::now();
+        start.store(true, std::memory_order_release);
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        uint64_t endInsert = BenchmarkClock::now();
+        rethrowFirst(errors);
+        result.insertTime = BenchmarkClock::elapsed(startInsert, endInsert);
+
+        uint64_t startDrain = BenchmarkClock::now();
+        std::vector<int> drained;
+        drained.reserve(dataSize);
+        queue.drain(drained);
+        std::vector<int> sortedData = CountingSort::sort(drained);
+        uint64_t endDrain = BenchmarkClock::now();
+        result.drainTime = BenchmarkClock::elapsed(startDrain, endDrain);
+
+        double seconds = result.insertTime.count() / 1000000000.0;
+        result.throughput = seconds > 0.0 ? (dataSize / 1000000.0) / seconds : 0.0;
+        result.success = sortedData == expected;
+        concurrentResults.push_back(result);
+    }
+
+    return concurrentResults;
+}
+
+std::vector<PerformanceAnalyzer::StackContentionResult> PerformanceAnalyzer::runStackContentionTest(
+    const int *ratings, size_t dataSize, unsigned maxThreads, bool batched) const
+{
+    const size_t BLOCK_SIZE = 64;
+    std::vector<StackContentionResult> contentionResults;
+    std::vector<int> expected = CountingSort::sort(std::vector<int>(ratings, ratings + dataSize));
+
+    for (unsigned threadCount = 1; threadCount <= std::max(maxThreads, 1u); ++threadCount)
+    {
+        StackContentionResult result;
+        result.threads = threadCount;
+        result.success = false;
+
+        ConcurrentStackStructure stack;
+        std::atomic<bool> start(false);
+        std::vector<std::thread> threads;
+        std::vector<std::vector<int>> popped(threadCount);
+        std::vector<std::exception_ptr> errors(threadCount);
+        size_t perThread = (dataSize + threadCount - 1) / threadCount;
+
+        for (unsigned t = 0; t < threadCount; ++t)
+        {
+            size_t begin = std::min(dataSize, t * perThread);
+            size_t end = std::min(dataSize, begin + perThread);
+            threads.emplace_back([&, t, begin, end]()
+                                 {
+                std::vector<int> &local = popped[t];
+                int buffer[BLOCK_SIZE];
+                while (!start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                try
+                {
+                    local.reserve((end - begin) / 2 + BLOCK_SIZE);
+                    for (size_t i = begin; i < end; i += BLOCK_SIZE)
+                    {
+                        size_t block = std::min(BLOCK_SIZE, end - i);
+                        size_t half = block / 2;
+                        size_t taken = 0;
+                        if (batched)
+                        {
+                            stack.pushBatch(ratings + i, block);
+                            taken = stack.popBatch(buffer, half);
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < block; ++j)
+                            {
+                                stack.push(ratings[i + j]);
+                            }
+                            while (taken < half && stack.pop(buffer[taken]))
+                            {
+                                taken++;
+                            }
+                        }
+                        local.insert(local.end(), buffer, buffer + taken);
+                    }
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                } });
+        }
+
+        uint64_t startTime = BenchmarkClock::now();
+        start.store(true, std::memory_order_release);
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        uint64_t endTime = BenchmarkClock::now();
+        rethrowFirst(errors);
+        result.time = BenchmarkClock::elapsed(startTime, endTime);
+
+        std::vector<int> collected;
+        collected.reserve(dataSize);
+        for (const auto &local : popped)
+        {
+            collected.insert(collected.end(), local.begin(), local.end());
+        }
+        size_t pops = collected.size();
+        stack.drain(collected);
+
+        result.operations = dataSize + pops;
+        double seconds = result.time.count() / 1000000000.0;
+        result.throughput = seconds > 0.0 ? (result.operations / 1000000.0) / seconds : 0.0;
+        result.success = CountingSort::sort(collected) == expected;
+        contentionResults.push_back(result);
+    }
+
+    return contentionResults;
+}
+
+size_t PerformanceAnalyzer::runSelfCheck() const
+{
+    std::vector<std::pair<std::string, std::vector<int>>> sequences;
+    sequences.push_back({"vazia", {}});
+    sequences.push_back({"unitária", {7}});
+    // Intervalo acima de 16 bits que depois cresce para baixo (base do Packed Vector em INT_MIN)
+    sequences.push_back({"larga para baixo", {100000, 1, 50}});
+    sequences.push_back({"negativos", {-70000, 70000, 0, -1, -70000, 3}});
+
+    std::vector<int> descending;
+    for (int value = 200000; value >= 0; value -= 7)
+    {
+        descending.push_back(value);
+    }
+    sequences.push_back({"decrescente", descending});
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> ratings(1, 10);
+    std::vector<int> small;
+    for (int i = 0; i < 1000; ++i)
+    {
+        small.push_back(ratings(rng));
+    }
+    sequences.push_back({"ratings 1..10", small});
+
+    const std::pair<SortMode, const char *> modes[] = {
+        {SortMode::Copy, "cópia"}, {SortMode::InPlace, "no lugar"}, {SortMode::Relink, "religar"}};
+
+    size_t failures = 0;
+    for (const auto &info : createStructureFactories())
+    {
+        for (const auto &mode : modes)
+        {
+            for (const auto &sequence : sequences)
+            {
+                std::vector<int> expected = sequence.second;
+                std::sort(expected.begin(), expected.end());
+
+                std::string error;
+                try
+                {
+                    auto structure = info.factory();
+                    for (int value : sequence.second)
+                    {
+                        structure->insert(value);
+                    }
+
+                    if (mode.first == SortMode::Copy)
+                    {
+                        structure->fromVector(CountingSort::sort(structure->toVector()));
+                    }
+                    else if (mode.first == SortMode::InPlace)
+                    {
+                        CountingSort::sortInPlace(*structure);
+                    }
+                    else
+                    {
+                        CountingSort::sortRelinked(*structure);
+                    }
+
+                    if (structure->toVector() != expected)
+                    {
+                        error = "resultado incorreto";
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    error = e.what();
+                }
+
+                if (!error.empty())
+                {
+                    std::cerr << "❌ " << info.typeName << " (" << mode.second << ", "
+                              << sequence.first << "): " << error << std::endl;
+                    failures++;
+                }
+            }
+        }
+    }
+    return failures;
+}
+
 void PerformanceAnalyzer::printDetailedResults() const
 {
 }
@@ -131,8 +507,20 @@ void PerformanceAnalyzer::saveResultsToCSV(const std::string &filename) const
     }
 
     file << "Estrutura,Tamanho,TempoCarregamento(ns),TempoConversaoVetor(ns),"
-         << "TempoOrdenacao(ns),TempoConversaoVolta(ns),TempoTotal(ns),MemoriaBytes,Sucesso"
-         << std::endl;
+         << "TempoOrdenacao(ns),TempoConversaoVolta(ns),TempoTotal(ns),TempoPontaAPonta(ns),OverheadRelogio(ns),"
+         << "TempoEscrita(ns),BytesEscritos,TempoCompactacao(ns),BytesCompactados,MemoriaBytes,"
+         << "PicoCarga,AlocCarga,PicoConversao,AlocConversao,PicoOrdenacao,AlocOrdenacao,"
+         << "PicoConversaoVolta,AlocConversaoVolta";
+    // Contadores por fase; campos vazios quando o evento não foi medido
+    const char *phaseNames[] = {"Carga", "Conversao", "Ordenacao", "ConversaoVolta"};
+    for (const char *phase : phaseNames)
+    {
+        for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+        {
+            file << "," << PerfCounters::eventName(static_cast<PerfCounters::Event>(event)) << phase;
+        }
+    }
+    file << ",Sucesso" << std::endl;
 
     for (const auto &result : results)
     {
@@ -143,8 +531,30 @@ void PerformanceAnalyzer::saveResultsToCSV(const std::string &filename) const
              << result.sortTime.count() << ","
              << result.convertBackTime.count() << ","
              << result.totalTime.count() << ","
+             << result.endToEndTime.count() << ","
+             << result.timerOverhead.count() << ","
+             << result.outputTime.count() << ","
+             << result.outputBytes << ","
+             << result.compressTime.count() << ","
+             << result.compressedBytes << ","
              << result.memoryUsage << ","
-             << (result.success ? "1" : "0")
+             << result.loadMemory.peakBytes << "," << result.loadMemory.allocations << ","
+             << result.convertMemory.peakBytes << "," << result.convertMemory.allocations << ","
+             << result.sortMemory.peakBytes << "," << result.sortMemory.allocations << ","
+             << result.convertBackMemory.peakBytes << "," << result.convertBackMemory.allocations << ",";
+        for (const PerfCounters::Sample *sample : {&result.loadCounters, &result.convertCounters,
+                                                   &result.sortCounters, &result.convertBackCounters})
+        {
+            for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+            {
+                if (sample->available[event])
+                {
+                    file << sample->values[event];
+                }
+                file << ",";
+            }
+        }
+        file << (result.success ? "1" : "0")
              << std::endl;
     }
 
@@ -185,8 +595,31 @@ void PerformanceAnalyzer::saveResultsToFile(const std::string &filename) const
         file << "Tempo de conversão para vetor: " << formatTimeNano(result.convertToVectorTime) << std::endl;
         file << "Tempo de ordenação: " << formatTimeNano(result.sortTime) << std::endl;
         file << "Tempo de conversão de volta: " << formatTimeNano(result.convertBackTime) << std::endl;
-        file << "Tempo total: " << formatTimeNano(result.totalTime) << std::endl;
-        file << "Uso estimado de memória: " << formatMemory(result.memoryUsage) << std::endl;
+        file << "Tempo total (soma das fases): " << formatTimeNano(result.totalTime) << std::endl;
+        file << "Tempo ponta a ponta: " << formatTimeNano(result.endToEndTime)
+             << " (relógio: " << BenchmarkClock::sourceName()
+             << ", overhead " << formatTimeNano(result.timerOverhead) << ")" << std::endl;
+        if (result.outputBytes > 0)
+        {
+            file << "Tempo de escrita: " << formatTimeNano(result.outputTime)
+                 << " (" << formatMemory(result.outputBytes) << ", "
+                 << formatThroughput(result.outputBytes, result.outputTime) << ")" << std::endl;
+        }
+        file << "Memória retida pela estrutura: " << formatMemory(result.memoryUsage)
+             << " (" << result.loadMemory.allocations << " alocações na carga)" << std::endl;
+        file << "Pico por fase: carga " << formatMemory(result.loadMemory.peakBytes)
+             << ", conversão " << formatMemory(result.convertMemory.peakBytes)
+             << ", ordenação " << formatMemory(result.sortMemory.peakBytes)
+             << ", volta " << formatMemory(result.convertBackMemory.peakBytes) << std::endl;
+        if (result.sortCounters.any())
+        {
+            file << "Ordenação: IPC " << result.sortCounters.ipc()
+                 << ", L1d/elem " << result.sortCounters.perElement(PerfCounters::L1DMisses, result.dataSize)
+                 << ", LLC/elem " << result.sortCounters.perElement(PerfCounters::LLCMisses, result.dataSize)
+                 << ", dTLB/elem " << result.sortCounters.perElement(PerfCounters::DTLBMisses, result.dataSize)
+                 << ", desvios/elem " << result.sortCounters.perElement(PerfCounters::BranchMisses, result.dataSize)
+                 << std::endl;
+        }
         file << std::string(50, '-') << std::endl;
     }
 
@@ -323,32 +756,6 @@ void PerformanceAnalyzer::saveResultsToFile(const std::string &filename) const
     file.close();
 }
 
-size_t PerformanceAnalyzer::estimateMemoryUsage(const DataStructure &structure, size_t dataSize) const
-{
-    size_t baseSize = dataSize * sizeof(int);
-
-    std::string type = structure.getType();
-
-    if (type.find("Vector") != std::string::npos)
-    {
-        return baseSize;
-    }
-    else if (type.find("List") != std::string::npos && structure.getDynamic())
-    {
-        return baseSize + (dataSize * sizeof(void *));
-    }
-    else if (type.find("Queue") != std::string::npos && structure.getDynamic())
-    {
-        return baseSize + (dataSize * sizeof(void *));
-    }
-    else if (type.find("Stack") != std::string::npos && structure.getDynamic())
-    {
-        return baseSize + (dataSize * sizeof(void *));
-    }
-
-    return baseSize;
-}
-
 std::string PerformanceAnalyzer::formatTimeNano(const std::chrono::nanoseconds &time) const
 {
     auto ns = time.count();
@@ -399,6 +806,16 @@ std::string PerformanceAnalyzer::formatMemory(size_t bytes) const
     }
 }
 
+std::string PerformanceAnalyzer::formatThroughput(size_t bytes, const std::chrono::nanoseconds &time) const
+{
+    if (time.count() <= 0)
+    {
+        return "N/A";
+    }
+    double mbPerSecond = (bytes / (1024.0 * 1024.0)) / (time.count() / 1000000000.0);
+    return std::to_string(mbPerSecond) + "MB/s";
+}
+
 std::vector<std::unique_ptr<DataStructure>> PerformanceAnalyzer::createAllStructures() const
 {
     std::vector<std::unique_ptr<DataStructure>> structures;
@@ -407,8 +824,10 @@ std::vector<std::unique_ptr<DataStructure>> PerformanceAnalyzer::createAllStruct
     structures.push_back(std::make_unique<VectorStructure>(true));
     structures.push_back(std::make_unique<ListStructure>(false));
     structures.push_back(std::make_unique<ListStructure>(true));
+    structures.push_back(std::make_unique<UnrolledListStructure>());
     structures.push_back(std::make_unique<QueueStructure>(false));
     structures.push_back(std::make_unique<QueueStructure>(true));
+    structures.push_back(std::make_unique<QueueStructure>(QueueStructure::Mode::Ring));
     structures.push_back(std::make_unique<StackStructure>(false));
     structures.push_back(std::make_unique<StackStructure>(true));
 
@@ -420,6 +839,37 @@ void PerformanceAnalyzer::setTestSizes(const std::vector<size_t> &sizes)
     testSizes = sizes;
 }
 
+void PerformanceAnalyzer::setSortMode(SortMode mode)
+{
+    sortMode = mode;
+}
+
+void PerformanceAnalyzer::setCompressedOutput(bool enabled)
+{
+    compressOutput = enabled;
+}
+
+bool PerformanceAnalyzer::setHardwareCounters(bool enabled)
+{
+    counters.reset();
+    if (enabled)
+    {
+        counters = std::make_unique<PerfCounters>();
+        if (!counters->available())
+        {
+            counters.reset();
+            return false;
+        }
+    }
+    return true;
+}
+
+void PerformanceAnalyzer::setOutput(const std::string &filename, const OutputWriter::Options &options)
+{
+    outputFile = filename;
+    outputOptions = options;
+}
+
 std::vector<PerformanceAnalyzer::StructureFactoryInfo> PerformanceAnalyzer::createStructureFactories() const
 {
     std::vector<PerformanceAnalyzer::StructureFactoryInfo> factories;
@@ -428,18 +878,34 @@ std::vector<PerformanceAnalyzer::StructureFactoryInfo> PerformanceAnalyzer::crea
                          { return std::make_unique<VectorStructure>(false); }});
     factories.push_back({"Dynamic Vector", true, []()
                          { return std::make_unique<VectorStructure>(true); }});
+    factories.push_back({"Packed Vector", true, []()
+                         { return std::make_unique<PackedVectorStructure>(); }});
     factories.push_back({"Linear List", false, []()
                          { return std::make_unique<ListStructure>(false); }});
     factories.push_back({"Dynamic List", true, []()
                          { return std::make_unique<ListStructure>(true); }});
+    factories.push_back({"Dynamic List (malloc)", true, []()
+                         { return std::make_unique<ListStructure>(true, AllocationPolicy::Malloc); }});
+    factories.push_back({"Unrolled List", true, []()
+                         { return std::make_unique<UnrolledListStructure>(); }});
     factories.push_back({"Linear Queue", false, []()
                          { return std::make_unique<QueueStructure>(false); }});
     factories.push_back({"Dynamic Queue", true, []()
                          { return std::make_unique<QueueStructure>(true); }});
+    factories.push_back({"Dynamic Queue (malloc)", true, []()
+                         { return std::make_unique<QueueStructure>(true, AllocationPolicy::Malloc); }});
+    factories.push_back({"Ring Queue", true, []()
+                         { return std::make_unique<QueueStructure>(QueueStructure::Mode::Ring); }});
+    factories.push_back({"Concurrent Queue", true, []()
+                         { return std::make_unique<ConcurrentQueueStructure>(); }});
+    factories.push_back({"Concurrent Stack", true, []()
+                         { return std::make_unique<ConcurrentStackStructure>(); }});
     factories.push_back({"Linear Stack", false, []()
                          { return std::make_unique<StackStructure>(false); }});
     factories.push_back({"Dynamic Stack", true, []()
                          { return std::make_unique<StackStructure>(true); }});
+    factories.push_back({"Dynamic Stack (malloc)", true, []()
+                         { return std::make_unique<StackStructure>(true, AllocationPolicy::Malloc); }});
 
     return factories;
 }
@@ -2,6 +2,10 @@
 #define PERFORMANCEANALYZER_HPP
 
 #include "DataStructure.hpp"
+#include "OutputWriter.hpp"
+#include "AllocationTracker.hpp"
+#include "BenchmarkContext.hpp"
+#include "PerfCounters.hpp"
 #include <chrono>
 #include <vector>
 #include <memory>
@@ -11,6 +15,15 @@
 class PerformanceAnalyzer
 {
 public:
+    // Copy: toVector → sort → fromVector; InPlace: CountingSort::sortInPlace;
+    // Relink: CountingSort::sortRelinked (religa nós das estruturas encadeadas)
+    enum class SortMode
+    {
+        Copy,
+        InPlace,
+        Relink
+    };
+
     struct PerformanceResult
     {
         std::string structureType;
@@ -19,18 +32,59 @@ public:
         std::chrono::nanoseconds convertToVectorTime;
         std::chrono::nanoseconds sortTime;
         std::chrono::nanoseconds convertBackTime;
-        std::chrono::nanoseconds totalTime;
-        size_t memoryUsage;
+        std::chrono::nanoseconds totalTime;     // Soma das fases (carga + conversão + ordenação + volta)
+        std::chrono::nanoseconds endToEndTime;  // Do início da carga ao fim da última fase, sem descontos
+        std::chrono::nanoseconds timerOverhead; // Custo de um par de leituras do BenchmarkClock
+        std::chrono::nanoseconds outputTime; // Gravação do resultado (fora do totalTime)
+        size_t outputBytes;
+        std::chrono::nanoseconds compressTime; // Ordenação direto para CompressedSortedSequence
+        size_t compressedBytes;
+        // Alocações medidas por fase (AllocationTracker)
+        AllocationTracker::PhaseStats loadMemory;
+        AllocationTracker::PhaseStats convertMemory;
+        AllocationTracker::PhaseStats sortMemory;
+        AllocationTracker::PhaseStats convertBackMemory;
+        // Contadores de hardware por fase (indisponíveis sem setHardwareCounters)
+        PerfCounters::Sample loadCounters;
+        PerfCounters::Sample convertCounters;
+        PerfCounters::Sample sortCounters;
+        PerfCounters::Sample convertBackCounters;
+        size_t memoryUsage; // Bytes retidos pela estrutura ao fim da carga
+        bool warm;          // Buffers do BenchmarkContext já tocados por uma repetição anterior
         bool success;
     };
 
 private:
     std::vector<PerformanceResult> results;
     std::vector<size_t> testSizes;
+    std::string outputFile;
+    OutputWriter::Options outputOptions;
+    SortMode sortMode;
+    bool compressOutput;
+    std::unique_ptr<PerfCounters> counters;
 
 public:
     PerformanceAnalyzer();
 
+    struct ConcurrentInsertResult
+    {
+        unsigned producers;
+        size_t dataSize;
+        std::chrono::nanoseconds insertTime; // Todas as threads produtoras
+        std::chrono::nanoseconds drainTime;  // drain + ordenação do resultado
+        double throughput;                   // Milhões de inserções por segundo
+        bool success;
+    };
+
+    struct StackContentionResult
+    {
+        unsigned threads;
+        size_t operations;              // push + pop somados
+        std::chrono::nanoseconds time;
+        double throughput;              // Milhões de operações por segundo
+        bool success;
+    };
+
     struct StructureFactoryInfo
     {
         std::string typeName;
@@ -40,10 +94,82 @@ public:
 
     std::vector<StructureFactoryInfo> createStructureFactories() const;
     void setTestSizes(const std::vector<size_t> &sizes);
+
+    /**
+     * Ativa a gravação dos dados ordenados em cada teste
+     * @param filename Arquivo de saída (vazio desativa)
+     * @param options Formato e paralelismo da gravação
+     */
+    void setOutput(const std::string &filename, const OutputWriter::Options &options);
+
+    /**
+     * Escolhe como a estrutura é ordenada; fora do modo Copy as fases
+     * de conversão ficam zeradas
+     */
+    void setSortMode(SortMode mode);
+
+    /**
+     * Ao fim de cada teste, ordena a entrada de novo emitindo direto numa
+     * CompressedSortedSequence e registra tempo e tamanho compactado
+     */
+    void setCompressedOutput(bool enabled);
+
+    /**
+     * Liga a coleta de contadores de hardware por fase (perf_event_open)
+     * @return false se nenhum contador pôde ser aberto; os testes seguem sem eles
+     */
+    bool setHardwareCounters(bool enabled);
     PerformanceResult runPerformanceTest(const std::vector<int> &ratings,
                                          std::unique_ptr<DataStructure> &structure,
                                          size_t dataSize);
+
+    /**
+     * Como runPerformanceTest, mas entrada, conversão, histograma e saída
+     * usam os buffers de context; a estrutura é reaproveitada via clear()
+     * @param context Buffers mantidos entre as repetições do mesmo teste
+     */
+    PerformanceResult runPerformanceTest(const std::vector<int> &ratings,
+                                         std::unique_ptr<DataStructure> &structure,
+                                         size_t dataSize,
+                                         BenchmarkContext &context);
     void runFullAnalysis(const std::vector<int> &ratings);
+
+    /**
+     * Mede a vazão de inserção na ConcurrentQueueStructure com 1..maxProducers
+     * threads, cada uma inserindo uma fatia dos dados; depois esvazia a fila
+     * com drain e ordena, conferindo o resultado
+     * @param ratings Dados de entrada
+     * @param dataSize Número de elementos em ratings
+     * @param maxProducers Maior número de threads produtoras
+     * @param batched Produtores usam insertBatch em vez de insert por elemento
+     * @throws Repassa, após o join, a primeira exceção de uma thread (ex.: std::bad_alloc)
+     */
+    std::vector<ConcurrentInsertResult> runConcurrentInsertTest(const int *ratings, size_t dataSize,
+                                                                unsigned maxProducers,
+                                                                bool batched = false) const;
+
+    /**
+     * Contenção na ConcurrentStackStructure com 1..maxThreads threads: cada
+     * thread empilha sua fatia em blocos e desempilha metade de cada bloco,
+     * disputando o mesmo topo; o restante é esvaziado com drain e o
+     * conjunto de valores é conferido com a entrada
+     * @param ratings Dados de entrada
+     * @param dataSize Número de elementos em ratings
+     * @param maxThreads Maior número de threads
+     * @param batched Usa pushBatch/popBatch em vez de push/pop por elemento
+     * @throws Repassa, após o join, a primeira exceção de uma thread (ex.: std::bad_alloc)
+     */
+    std::vector<StackContentionResult> runStackContentionTest(const int *ratings, size_t dataSize,
+                                                              unsigned maxThreads,
+                                                              bool batched = false) const;
+
+    /**
+     * Confere a ordenação de todas as estruturas nos três modos (cópia, no
+     * lugar e religação) com sequências que forçam recodificação e
+     * crescimento do intervalo para baixo; falhas são listadas em std::cerr
+     * @return Número de combinações (estrutura × modo × sequência) com falha
+     */
+    size_t runSelfCheck() const;
     void printDetailedResults() const;
     void printSummary() const;
     void saveResultsToCSV(const std::string &filename) const;
@@ -51,10 +177,10 @@ public:
     void calculateStatistics() const;
 
 private:
-    size_t estimateMemoryUsage(const DataStructure &structure, size_t dataSize) const;
     std::string formatTimeNano(const std::chrono::nanoseconds &time) const;
     std::string formatTime(const std::chrono::milliseconds &time) const;
     std::string formatMemory(size_t bytes) const;
+    std::string formatThroughput(size_t bytes, const std::chrono::nanoseconds &time) const;
     std::vector<std::unique_ptr<DataStructure>> createAllStructures() const;
 };
 
@@ -1,36 +1,103 @@
 #include "QueueStructure.hpp"
+#include "LinkedSort.hpp"
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
 
-QueueStructure::QueueStructure(bool dynamic) : DataStructure(dynamic)
+namespace
 {
-    if (isDynamic)
+    constexpr size_t RING_INITIAL_CAPACITY = 16;
+
+    // std::queue não expõe o contêiner; o membro protegido 'c' é acessado por herança
+    struct QueueAccess : std::queue<int>
     {
-        front = nullptr;
-        rear = nullptr;
-        currentSize = 0;
+        static const std::deque<int> &container(const std::queue<int> &queue)
+        {
+            return queue.*(&QueueAccess::c);
+        }
+
+        static std::deque<int> &container(std::queue<int> &queue)
+        {
+            return queue.*(&QueueAccess::c);
+        }
+    };
+
+}
+
+QueueStructure::QueueStructure(bool dynamic, AllocationPolicy policy)
+    : QueueStructure(dynamic ? Mode::Dynamic : Mode::Linear, policy)
+{
+}
+
+QueueStructure::QueueStructure(Mode queueMode, AllocationPolicy policy)
+    : DataStructure(queueMode != Mode::Linear), front(nullptr), rear(nullptr), currentSize(0), nodes(policy),
+      mode(queueMode), ringBuffer(nullptr), ringCapacity(0), ringHead(0)
+{
+    if (mode == Mode::Ring)
+    {
+        reserveRing(RING_INITIAL_CAPACITY);
     }
 }
 
 QueueStructure::~QueueStructure()
 {
-    if (isDynamic)
+    if (mode == Mode::Dynamic)
     {
         clearDynamicQueue();
     }
+    delete[] ringBuffer;
 }
 
 void QueueStructure::clearDynamicQueue()
 {
-    while (!isEmpty())
+    nodes.releaseChain(front);
+    front = nullptr;
+    rear = nullptr;
+    currentSize = 0;
+}
+
+void QueueStructure::reserveRing(size_t minCapacity)
+{
+    if (minCapacity <= ringCapacity)
     {
-        dequeue();
+        return;
     }
-    currentSize = 0;
+
+    size_t newCapacity = std::max(ringCapacity, RING_INITIAL_CAPACITY);
+    while (newCapacity < minCapacity)
+    {
+        newCapacity *= 2;
+    }
+
+    // Realinha os elementos no início do novo buffer (até duas cópias)
+    int *newBuffer = new int[newCapacity];
+    size_t firstPart = std::min(currentSize, ringCapacity - ringHead);
+    if (currentSize > 0)
+    {
+        std::memcpy(newBuffer, ringBuffer + ringHead, firstPart * sizeof(int));
+        std::memcpy(newBuffer + firstPart, ringBuffer, (currentSize - firstPart) * sizeof(int));
+    }
+
+    delete[] ringBuffer;
+    ringBuffer = newBuffer;
+    ringCapacity = newCapacity;
+    ringHead = 0;
 }
 
 void QueueStructure::enqueue(int value)
 {
-    Node *newNode = new Node(value);
+    if (mode == Mode::Ring)
+    {
+        if (currentSize == ringCapacity)
+        {
+            reserveRing(ringCapacity * 2);
+        }
+        ringBuffer[(ringHead + currentSize) & (ringCapacity - 1)] = value;
+        currentSize++;
+        return;
+    }
+
+    Node *newNode = nodes.create(value);
 
     if (rear == nullptr)
     {
@@ -52,6 +119,14 @@ int QueueStructure::dequeue()
         throw std::runtime_error("Queue is empty");
     }
 
+    if (mode == Mode::Ring)
+    {
+        int value = ringBuffer[ringHead];
+        ringHead = (ringHead + 1) & (ringCapacity - 1);
+        currentSize--;
+        return value;
+    }
+
     Node *temp = front;
     int value = temp->data;
     front = front->next;
@@ -61,14 +136,82 @@ int QueueStructure::dequeue()
         rear = nullptr;
     }
 
-    delete temp;
+    nodes.destroy(temp);
     currentSize--;
     return value;
 }
 
+void QueueStructure::enqueueBulk(const int *values, size_t count)
+{
+    if (mode == Mode::Linear)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            linearQueue.push(values[i]);
+        }
+        return;
+    }
+    if (mode == Mode::Dynamic)
+    {
+        nodes.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            enqueue(values[i]);
+        }
+        return;
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+    reserveRing(currentSize + count);
+
+    size_t tail = (ringHead + currentSize) & (ringCapacity - 1);
+    size_t firstPart = std::min(count, ringCapacity - tail);
+    std::memcpy(ringBuffer + tail, values, firstPart * sizeof(int));
+    std::memcpy(ringBuffer, values + firstPart, (count - firstPart) * sizeof(int));
+    currentSize += count;
+}
+
+size_t QueueStructure::dequeueBulk(int *out, size_t maxCount)
+{
+    if (mode == Mode::Linear)
+    {
+        size_t removed = 0;
+        while (removed < maxCount && !linearQueue.empty())
+        {
+            out[removed++] = linearQueue.front();
+            linearQueue.pop();
+        }
+        return removed;
+    }
+
+    size_t count = std::min(maxCount, currentSize);
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (mode == Mode::Dynamic)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = dequeue();
+        }
+        return count;
+    }
+
+    size_t firstPart = std::min(count, ringCapacity - ringHead);
+    std::memcpy(out, ringBuffer + ringHead, firstPart * sizeof(int));
+    std::memcpy(out + firstPart, ringBuffer, (count - firstPart) * sizeof(int));
+    ringHead = (ringHead + count) & (ringCapacity - 1);
+    currentSize -= count;
+    return count;
+}
+
 bool QueueStructure::isEmpty() const
 {
-    return front == nullptr;
+    return mode == Mode::Ring ? currentSize == 0 : front == nullptr;
 }
 
 void QueueStructure::insert(int value)
@@ -85,7 +228,12 @@ void QueueStructure::insert(int value)
 
 void QueueStructure::clear()
 {
-    if (isDynamic)
+    if (mode == Mode::Ring)
+    {
+        ringHead = 0;
+        currentSize = 0;
+    }
+    else if (isDynamic)
     {
         clearDynamicQueue();
     }
@@ -98,42 +246,139 @@ void QueueStructure::clear()
 std::vector<int> QueueStructure::toVector() const
 {
     std::vector<int> result;
+    toVector(result);
+    return result;
+}
 
-    if (isDynamic)
+void QueueStructure::toVector(std::vector<int> &out) const
+{
+    if (mode == Mode::Ring)
     {
-        Node *current = front;
-        while (current != nullptr)
+        // Conteúdo contíguo em no máximo dois trechos do buffer
+        out.resize(currentSize);
+        size_t firstPart = std::min(currentSize, ringCapacity - ringHead);
+        if (currentSize > 0)
         {
-            result.push_back(current->data);
-            current = current->next;
+            std::memcpy(out.data(), ringBuffer + ringHead, firstPart * sizeof(int));
+            std::memcpy(out.data() + firstPart, ringBuffer, (currentSize - firstPart) * sizeof(int));
         }
     }
-    else
+    else if (mode == Mode::Dynamic)
     {
-        std::queue<int> tempQueue = linearQueue;
-        while (!tempQueue.empty())
+        out.resize(currentSize);
+        int *dest = out.data();
+        for (Node *current = front; current != nullptr; current = current->next)
         {
-            result.push_back(tempQueue.front());
-            tempQueue.pop();
+            *dest++ = current->data;
         }
     }
+    else
+    {
+        const std::deque<int> &container = QueueAccess::container(linearQueue);
+        out.assign(container.begin(), container.end());
+    }
+}
 
-    return result;
+void QueueStructure::insertBatch(const int *values, size_t count)
+{
+    enqueueBulk(values, count);
 }
 
 void QueueStructure::fromVector(const std::vector<int> &vec)
 {
     clear();
+    enqueueBulk(vec.data(), vec.size());
+}
 
-    for (const auto &value : vec)
+void QueueStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    if (mode == Mode::Ring)
     {
-        insert(value);
+        size_t firstPart = std::min(currentSize, ringCapacity - ringHead);
+        if (firstPart > 0)
+        {
+            visitor(ringBuffer + ringHead, firstPart);
+        }
+        if (currentSize > firstPart)
+        {
+            visitor(ringBuffer, currentSize - firstPart);
+        }
+    }
+    else if (mode == Mode::Dynamic)
+    {
+        const Node *current = front;
+        visitStaged([&]() -> const int *
+                    {
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+            const int *value = &current->data;
+            current = current->next;
+            return value; },
+                    visitor);
+    }
+    else
+    {
+        visitContiguousRuns(QueueAccess::container(linearQueue), visitor);
+    }
+}
+
+void QueueStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    if (mode == Mode::Ring)
+    {
+        size_t firstPart = std::min(currentSize, ringCapacity - ringHead);
+        if (firstPart > 0)
+        {
+            visitor(ringBuffer + ringHead, firstPart);
+        }
+        if (currentSize > firstPart)
+        {
+            visitor(ringBuffer, currentSize - firstPart);
+        }
+    }
+    else if (mode == Mode::Dynamic)
+    {
+        Node *current = front;
+        updateStaged([&]() -> int *
+                     {
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+            int *value = &current->data;
+            current = current->next;
+            return value; },
+                     visitor);
+    }
+    else
+    {
+        visitContiguousRuns(QueueAccess::container(linearQueue), visitor);
     }
 }
 
+bool QueueStructure::relinkSort()
+{
+    if (mode != Mode::Dynamic)
+    {
+        return false;
+    }
+    LinkedSort::sort(front, rear);
+    return true;
+}
+
 std::string QueueStructure::getType() const
 {
-    return isDynamic ? "Dynamic Queue" : "Linear Queue";
+    if (mode == Mode::Ring)
+    {
+        return "Ring Queue";
+    }
+    if (!isDynamic)
+    {
+        return "Linear Queue";
+    }
+    return nodes.getPolicy() == AllocationPolicy::Malloc ? "Dynamic Queue (malloc)" : "Dynamic Queue";
 }
 
 size_t QueueStructure::size()
@@ -2,10 +2,20 @@
 #define QUEUESTRUCTURE_HPP
 
 #include "DataStructure.hpp"
+#include "NodeArena.hpp"
 #include <queue>
 
 class QueueStructure : public DataStructure
 {
+public:
+    // Linear: std::queue; Dynamic: nós encadeados; Ring: buffer circular potência de dois
+    enum class Mode
+    {
+        Linear,
+        Dynamic,
+        Ring
+    };
+
 private:
     struct Node
     {
@@ -17,11 +27,18 @@ private:
     Node *front;
     Node *rear;
     size_t currentSize;
+    NodeArena<Node> nodes;
 
     std::queue<int> linearQueue;
 
+    Mode mode;
+    int *ringBuffer;
+    size_t ringCapacity; // Sempre potência de dois
+    size_t ringHead;     // Índice do primeiro elemento
+
 public:
-    explicit QueueStructure(bool dynamic = false);
+    explicit QueueStructure(bool dynamic = false, AllocationPolicy policy = AllocationPolicy::Arena);
+    explicit QueueStructure(Mode queueMode, AllocationPolicy policy = AllocationPolicy::Arena);
     ~QueueStructure() override;
 
     void insert(int value) override;
@@ -30,14 +47,34 @@ public:
     void fromVector(const std::vector<int> &vec) override;
     std::string getType() const override;
 
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+    void forEachChunk(const ChunkVisitor &visitor) const override;
+    void updateEachChunk(const MutableChunkVisitor &visitor) override;
+    bool relinkSort() override;
+
     size_t size();
     bool empty();
 
+    /**
+     * Enfileira count valores de uma vez (no modo Ring, até duas cópias contíguas)
+     */
+    void enqueueBulk(const int *values, size_t count);
+
+    /**
+     * Remove até maxCount valores do início da fila
+     * @param out Destino com espaço para maxCount valores
+     * @return Quantidade de valores removidos
+     */
+    size_t dequeueBulk(int *out, size_t maxCount);
+
 private:
     void clearDynamicQueue();
     void enqueue(int value);
     int dequeue();
     bool isEmpty() const;
+    void reserveRing(size_t minCapacity);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "RadixSort.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // Inverte o bit de sinal: a ordem sem sinal das chaves é a ordem dos valores
+    inline uint64_t toKey(int64_t value)
+    {
+        return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+    }
+}
+
+void RadixSort::sort(int64_t *data, size_t size, int64_t *scratch)
+{
+    if (size < 2)
+    {
+        return;
+    }
+
+    std::vector<size_t> counts(DIGITS * BUCKETS, 0);
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint64_t key = toKey(data[i]);
+        for (unsigned digit = 0; digit < DIGITS; ++digit)
+        {
+            counts[digit * BUCKETS + ((key >> (digit * DIGIT_BITS)) & (BUCKETS - 1))]++;
+        }
+    }
+
+    int64_t *source = data;
+    int64_t *destination = scratch;
+    for (unsigned digit = 0; digit < DIGITS; ++digit)
+    {
+        const unsigned shift = digit * DIGIT_BITS;
+        size_t *count = counts.data() + digit * BUCKETS;
+
+        // Dígito igual em todas as chaves: a passada não mudaria a ordem
+        if (count[(toKey(source[0]) >> shift) & (BUCKETS - 1)] == size)
+        {
+            continue;
+        }
+
+        size_t position = 0;
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+        {
+            size_t occurrences = count[bucket];
+            count[bucket] = position;
+            position += occurrences;
+        }
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            destination[count[(toKey(source[i]) >> shift) & (BUCKETS - 1)]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != data)
+    {
+        std::copy(source, source + size, data);
+    }
+}
+
+bool RadixSort::isSorted(const int64_t *data, size_t size)
+{
+    return std::is_sorted(data, data + size);
+}
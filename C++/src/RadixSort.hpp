@@ -0,0 +1,33 @@
+#ifndef RADIXSORT_HPP
+#define RADIXSORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Radix sort LSD para chaves de 64 bits
+ * Quatro dígitos de 16 bits, cada um ordenado por contagem (estável); os
+ * quatro histogramas saem de uma única leitura dos dados e os dígitos
+ * iguais em todas as chaves não geram passada. A memória de contagem é
+ * fixa (4 × 65536 contadores), ao contrário do CountingSort, cujo
+ * histograma cresce com a amplitude dos valores.
+ */
+class RadixSort
+{
+public:
+    static constexpr unsigned DIGIT_BITS = 16;
+    static constexpr unsigned DIGITS = 64 / DIGIT_BITS;
+    static constexpr size_t BUCKETS = size_t(1) << DIGIT_BITS;
+
+    /**
+     * Ordena em ordem crescente (valores negativos inclusive)
+     * @param data Valores a ordenar; recebe o resultado
+     * @param size Número de elementos
+     * @param scratch Buffer auxiliar com pelo menos size elementos
+     */
+    static void sort(int64_t *data, size_t size, int64_t *scratch);
+
+    static bool isSorted(const int64_t *data, size_t size);
+};
+
+#endif // RADIXSORT_HPP
@@ -0,0 +1,137 @@
+#include "RecordSampler.hpp"
+#include <algorithm>
+
+RecordSampler::RecordSampler(Mode samplingMode, size_t sampleSize, uint64_t seed)
+    : mode(samplingMode), target(sampleSize), seen(0), stride(1), rng(seed)
+{
+    // Sem tamanho alvo todos os registros são mantidos
+    if (target == 0)
+    {
+        mode = Mode::Head;
+    }
+}
+
+void RecordSampler::offer(int value)
+{
+    size_t position = seen++;
+
+    switch (mode)
+    {
+    case Mode::Head:
+        if (target == 0 || kept.size() < target)
+        {
+            kept.push_back(value);
+        }
+        break;
+
+    case Mode::Reservoir:
+        // Algoritmo R: o registro i substitui um item com probabilidade N/(i+1)
+        if (reservoir.size() < target)
+        {
+            reservoir.emplace_back(position, value);
+        }
+        else
+        {
+            std::uniform_int_distribution<size_t> dist(0, position);
+            size_t slot = dist(rng);
+            if (slot < target)
+            {
+                reservoir[slot] = {position, value};
+            }
+        }
+        break;
+
+    case Mode::Stride:
+        // Mantém posições múltiplas de stride; ao atingir 2N descarta metade e dobra o passo
+        if (position % stride == 0)
+        {
+            kept.push_back(value);
+            if (kept.size() == 2 * target)
+            {
+                for (size_t i = 0; i < target; ++i)
+                {
+                    kept[i] = kept[2 * i];
+                }
+                kept.resize(target);
+                stride *= 2;
+            }
+        }
+        break;
+    }
+}
+
+bool RecordSampler::done() const
+{
+    return mode == Mode::Head && target != 0 && kept.size() >= target;
+}
+
+size_t RecordSampler::getSeen() const
+{
+    return seen;
+}
+
+std::vector<int> RecordSampler::finish()
+{
+    std::vector<int> result;
+
+    if (mode == Mode::Reservoir)
+    {
+        std::sort(reservoir.begin(), reservoir.end());
+        result.reserve(reservoir.size());
+        for (const auto &entry : reservoir)
+        {
+            result.push_back(entry.second);
+        }
+        reservoir.clear();
+    }
+    else if (mode == Mode::Stride && kept.size() > target)
+    {
+        // Entre N e 2N itens igualmente espaçados: seleciona N uniformemente
+        result.reserve(target);
+        for (size_t i = 0; i < target; ++i)
+        {
+            result.push_back(kept[i * kept.size() / target]);
+        }
+        kept.clear();
+    }
+    else
+    {
+        result.swap(kept);
+    }
+
+    seen = 0;
+    stride = 1;
+    return result;
+}
+
+std::vector<int> RecordSampler::sample(const std::vector<int> &data, size_t sampleSize,
+                                       Mode samplingMode, uint64_t seed)
+{
+    return sample(data.data(), data.size(), sampleSize, samplingMode, seed);
+}
+
+std::vector<int> RecordSampler::sample(const int *data, size_t dataSize, size_t sampleSize,
+                                       Mode samplingMode, uint64_t seed)
+{
+    RecordSampler sampler(samplingMode, sampleSize, seed);
+    for (size_t i = 0; i < dataSize && !sampler.done(); ++i)
+    {
+        sampler.offer(data[i]);
+    }
+    return sampler.finish();
+}
+
+const char *RecordSampler::modeName(Mode samplingMode)
+{
+    switch (samplingMode)
+    {
+    case Mode::Head:
+        return "head";
+    case Mode::Reservoir:
+        return "reservoir";
+    case Mode::Stride:
+        return "stride";
+    default:
+        return "desconhecido";
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef RECORDSAMPLER_HPP
+#define RECORDSAMPLER_HPP
+
+#include <vector>
+#include <random>
+#include <utility>
+#include <cstdint>
+
+/**
+ * Amostragem de registros em uma única passada com memória limitada
+ * Head: primeiros N registros (comportamento original)
+ * Reservoir: amostra aleatória uniforme de N registros (semente fixa)
+ * Stride: N registros igualmente espaçados ao longo do arquivo
+ * Em todos os modos a amostra final mantém a ordem do arquivo
+ */
+class RecordSampler
+{
+public:
+    enum class Mode
+    {
+        Head,
+        Reservoir,
+        Stride
+    };
+
+private:
+    Mode mode;
+    size_t target;
+    size_t seen;
+    size_t stride;
+    std::mt19937_64 rng;
+    std::vector<int> kept;                          // Head e Stride
+    std::vector<std::pair<size_t, int>> reservoir; // (posição, valor)
+
+public:
+    /**
+     * @param samplingMode Modo de amostragem
+     * @param sampleSize Tamanho da amostra (0 = todos os registros)
+     * @param seed Semente do gerador (Reservoir)
+     */
+    RecordSampler(Mode samplingMode, size_t sampleSize, uint64_t seed = 42);
+
+    /**
+     * Oferece o próximo registro válido do fluxo
+     * @param value Valor do registro
+     */
+    void offer(int value);
+
+    /**
+     * Indica que nenhum registro adicional mudará a amostra (Head cheio)
+     */
+    bool done() const;
+
+    /**
+     * Número de registros oferecidos até agora
+     */
+    size_t getSeen() const;
+
+    /**
+     * Retorna a amostra em ordem de arquivo e reinicia o amostrador
+     */
+    std::vector<int> finish();
+
+    /**
+     * Amostra um vetor já carregado em memória
+     * @param data Registros de origem
+     * @param sampleSize Tamanho da amostra
+     * @param samplingMode Modo de amostragem
+     * @param seed Semente do gerador
+     * @return Amostra em ordem de origem
+     */
+    static std::vector<int> sample(const std::vector<int> &data, size_t sampleSize,
+                                   Mode samplingMode, uint64_t seed = 42);
+
+    // Mesma amostragem sobre um buffer qualquer (ex.: WorkloadGenerator::Buffer)
+    static std::vector<int> sample(const int *data, size_t dataSize, size_t sampleSize,
+                                   Mode samplingMode, uint64_t seed = 42);
+
+    static const char *modeName(Mode samplingMode);
+};
+
+#endif // RECORDSAMPLER_HPP
@@ -1,7 +1,26 @@
 #include "StackStructure.hpp"
+#include "LinkedSort.hpp"
 #include <stdexcept>
 
-StackStructure::StackStructure(bool dynamic) : DataStructure(dynamic)
+namespace
+{
+    // std::stack não expõe o contêiner; o membro protegido 'c' é acessado por herança
+    struct StackAccess : std::stack<int>
+    {
+        static const std::deque<int> &container(const std::stack<int> &stack)
+        {
+            return stack.*(&StackAccess::c);
+        }
+
+        static std::deque<int> &container(std::stack<int> &stack)
+        {
+            return stack.*(&StackAccess::c);
+        }
+    };
+
+}
+
+StackStructure::StackStructure(bool dynamic, AllocationPolicy policy) : DataStructure(dynamic), nodes(policy)
 {
     if (isDynamic)
     {
@@ -20,16 +39,14 @@ StackStructure::~StackStructure()
 
 void StackStructure::clearDynamicStack()
 {
-    while (!isEmpty())
-    {
-        pop();
-    }
+    nodes.releaseChain(top);
+    top = nullptr;
     currentSize = 0;
 }
 
 void StackStructure::push(int value)
 {
-    Node *newNode = new Node(value);
+    Node *newNode = nodes.create(value);
     newNode->next = top;
     top = newNode;
     currentSize++;
@@ -45,7 +62,7 @@ int StackStructure::pop()
     Node *temp = top;
     int value = temp->data;
     top = top->next;
-    delete temp;
+    nodes.destroy(temp);
     currentSize--;
     return value;
 }
@@ -83,56 +100,127 @@ void StackStructure::clear()
 std::vector<int> StackStructure::toVector() const
 {
     std::vector<int> result;
+    toVector(result);
+    return result;
+}
 
+void StackStructure::toVector(std::vector<int> &out) const
+{
     if (isDynamic)
     {
-        // Para pilha, precisamos inverter a ordem para manter a ordem de inserção
-        std::vector<int> temp;
-        Node *current = top;
-        while (current != nullptr)
-        {
-            temp.push_back(current->data);
-            current = current->next;
-        }
-        // Inverte para manter ordem de inserção
-        for (int i = temp.size() - 1; i >= 0; --i)
+        // O topo é o último inserido: preenche de trás para frente para manter a ordem de inserção
+        out.resize(currentSize);
+        size_t index = currentSize;
+        for (Node *current = top; current != nullptr; current = current->next)
         {
-            result.push_back(temp[i]);
+            out[--index] = current->data;
         }
     }
     else
     {
-        // Como std::stack não permite iteração, precisamos fazer uma cópia
-        std::stack<int> tempStack = linearStack;
-        std::vector<int> temp;
-        while (!tempStack.empty())
+        // O contêiner da std::stack já está na ordem de inserção (base → topo)
+        const std::deque<int> &container = StackAccess::container(linearStack);
+        out.assign(container.begin(), container.end());
+    }
+}
+
+void StackStructure::insertBatch(const int *values, size_t count)
+{
+    if (isDynamic)
+    {
+        nodes.reserve(count);
+        for (size_t i = 0; i < count; ++i)
         {
-            temp.push_back(tempStack.top());
-            tempStack.pop();
+            push(values[i]);
         }
-        // Inverte para manter ordem de inserção
-        for (int i = temp.size() - 1; i >= 0; --i)
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
         {
-            result.push_back(temp[i]);
+            linearStack.push(values[i]);
         }
     }
-
-    return result;
 }
 
 void StackStructure::fromVector(const std::vector<int> &vec)
 {
     clear();
+    insertBatch(vec.data(), vec.size());
+}
 
-    for (const auto &value : vec)
+void StackStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    if (isDynamic)
+    {
+        // Percorre a cadeia do topo à base, sem copiar a pilha
+        const Node *current = top;
+        visitStaged([&]() -> const int *
+                    {
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+            const int *value = &current->data;
+            current = current->next;
+            return value; },
+                    visitor);
+    }
+    else
     {
-        insert(value);
+        visitContiguousRuns(StackAccess::container(linearStack), visitor);
     }
 }
 
+void StackStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    if (isDynamic)
+    {
+        // Inverte a cadeia para a ordem de inserção, regrava os nós no lugar e
+        // desfaz a inversão; nenhum nó é liberado ou alocado
+        Node *bottom = LinkedSort::reverse(top);
+        Node *current = bottom;
+        updateStaged([&]() -> int *
+                     {
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+            int *value = &current->data;
+            current = current->next;
+            return value; },
+                     visitor);
+        top = LinkedSort::reverse(bottom);
+    }
+    else
+    {
+        visitContiguousRuns(StackAccess::container(linearStack), visitor);
+    }
+}
+
+bool StackStructure::relinkSort()
+{
+    if (!isDynamic)
+    {
+        return false;
+    }
+
+    // A cadeia vai do topo à base: inverte para a ordem de inserção, ordena
+    // (estável) e inverte de volta para que a base fique com o menor valor
+    Node *bottom = LinkedSort::reverse(top);
+    Node *last = bottom;
+    LinkedSort::sort(bottom, last);
+    top = LinkedSort::reverse(bottom);
+    return true;
+}
+
 std::string StackStructure::getType() const
 {
-    return isDynamic ? "Dynamic Stack" : "Linear Stack";
+    if (!isDynamic)
+    {
+        return "Linear Stack";
+    }
+    return nodes.getPolicy() == AllocationPolicy::Malloc ? "Dynamic Stack (malloc)" : "Dynamic Stack";
 }
 
 size_t StackStructure::size() const
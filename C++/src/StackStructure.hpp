@@ -2,6 +2,7 @@
 #define STACKSTRUCTURE_HPP
 
 #include "DataStructure.hpp"
+#include "NodeArena.hpp"
 #include <stack>
 
 class StackStructure : public DataStructure
@@ -16,11 +17,12 @@ private:
 
     Node *top;
     size_t currentSize;
+    NodeArena<Node> nodes;
 
     std::stack<int> linearStack;
 
 public:
-    explicit StackStructure(bool dynamic = false);
+    explicit StackStructure(bool dynamic = false, AllocationPolicy policy = AllocationPolicy::Arena);
     ~StackStructure() override;
 
     void insert(int value) override;
@@ -29,6 +31,13 @@ public:
     void fromVector(const std::vector<int> &vec) override;
     std::string getType() const override;
 
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+    void forEachChunk(const ChunkVisitor &visitor) const override;
+    void updateEachChunk(const MutableChunkVisitor &visitor) override;
+    bool relinkSort() override;
+
     size_t size() const;
     bool empty() const;
 
@@ -0,0 +1,31 @@
+#include "StaticBenchmark.hpp"
+
+void StaticBenchmark::runAll(const std::vector<int> &data, const RepetitionCallback &onRepetition)
+{
+    runEach<StaticVector, StaticList, StaticQueue, StaticStack>(data, onRepetition);
+}
+
+StaticBenchmark::Result StaticBenchmark::emptyResult(const std::string &structureType, size_t dataSize)
+{
+    using std::chrono::nanoseconds;
+
+    Result result;
+    result.structureType = structureType;
+    result.dataSize = dataSize;
+    result.outputTime = nanoseconds(0);
+    result.outputBytes = 0;
+    result.compressTime = nanoseconds(0);
+    result.compressedBytes = 0;
+    result.loadTime = result.convertToVectorTime = result.sortTime = result.convertBackTime = nanoseconds(0);
+    result.totalTime = result.endToEndTime = nanoseconds(0);
+    result.loadMemory = result.convertMemory = result.sortMemory = result.convertBackMemory = {0, 0, 0};
+    result.memoryUsage = 0;
+    result.timerOverhead = BenchmarkClock::overhead();
+    result.warm = false;
+    result.loadCounters = PerfCounters::emptySample();
+    result.convertCounters = PerfCounters::emptySample();
+    result.sortCounters = PerfCounters::emptySample();
+    result.convertBackCounters = PerfCounters::emptySample();
+    result.success = false;
+    return result;
+}
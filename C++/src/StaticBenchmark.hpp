@@ -0,0 +1,141 @@
+#ifndef STATICBENCHMARK_HPP
+#define STATICBENCHMARK_HPP
+
+#include "StaticStructures.hpp"
+#include "PerformanceAnalyzer.hpp"
+#include "BenchmarkContext.hpp"
+#include "CountingSort.hpp"
+#include "BenchmarkClock.hpp"
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Benchmark tipado das variantes estáticas (StaticStructures.hpp)
+ * Cada par (estrutura × engine) é instanciado em tempo de compilação,
+ * então o laço de carga chama insertImpl diretamente (inline).
+ * As fases medidas são as mesmas de PerformanceAnalyzer::runPerformanceTest,
+ * e as repetições de um par reaproveitam a estrutura e o BenchmarkContext.
+ */
+class StaticBenchmark
+{
+public:
+    using Result = PerformanceAnalyzer::PerformanceResult;
+
+    // Recebe cada repetição; devolve true para pedir outra do mesmo par
+    using RepetitionCallback = std::function<bool(const Result &)>;
+
+    /**
+     * Executa carga, conversão, ordenação e conversão de volta para um par
+     * @param structure Estrutura reaproveitada entre as repetições (esvaziada no início)
+     * @param data Dados de entrada (já no volume desejado)
+     * @param context Buffers reaproveitados; a primeira repetição é a fria
+     * @return Resultado com structureType igual ao da versão virtual (ex.: "Dynamic List")
+     */
+    template <template <typename> class Structure, typename Engine>
+    static Result run(Structure<Engine> &structure, const std::vector<int> &data, BenchmarkContext &context)
+    {
+        Result result = emptyResult(std::string(Engine::name) + " " + Structure<Engine>::kind(), data.size());
+        result.warm = context.isWarm();
+
+        try
+        {
+            const std::vector<int> &testData = context.loadInput(data, data.size());
+
+            structure.clear();
+
+            AllocationTracker::Phase loadPhase;
+            uint64_t startLoad = BenchmarkClock::now();
+            for (int value : testData)
+            {
+                structure.insert(value);
+            }
+            uint64_t endLoad = BenchmarkClock::now();
+            result.loadMemory = loadPhase.finish();
+            result.loadTime = BenchmarkClock::elapsed(startLoad, endLoad);
+
+            std::vector<int> &vectorData = context.converted();
+            AllocationTracker::Phase convertPhase;
+            uint64_t startConvert = BenchmarkClock::now();
+            structure.toVector(vectorData);
+            uint64_t endConvert = BenchmarkClock::now();
+            result.convertMemory = convertPhase.finish();
+            result.convertToVectorTime = BenchmarkClock::elapsed(startConvert, endConvert);
+
+            std::vector<int> &sortedData = context.output();
+            AllocationTracker::Phase sortPhase;
+            uint64_t startSort = BenchmarkClock::now();
+            CountingSort::sortInto(vectorData, sortedData, context.scratch());
+            uint64_t endSort = BenchmarkClock::now();
+            result.sortMemory = sortPhase.finish();
+            result.sortTime = BenchmarkClock::elapsed(startSort, endSort);
+
+            AllocationTracker::Phase convertBackPhase;
+            uint64_t startConvertBack = BenchmarkClock::now();
+            structure.fromVector(sortedData);
+            uint64_t endConvertBack = BenchmarkClock::now();
+            result.convertBackMemory = convertBackPhase.finish();
+            result.convertBackTime = BenchmarkClock::elapsed(startConvertBack, endConvertBack);
+
+            result.totalTime = result.loadTime + result.convertToVectorTime +
+                               result.sortTime + result.convertBackTime;
+            result.endToEndTime = BenchmarkClock::elapsed(startLoad, endConvertBack);
+            // Atribuição por instância (CountingAllocator / capacidade real)
+            result.memoryUsage = structure.memoryUsage();
+            result.success = structure.size() == data.size() && CountingSort::isSorted(sortedData);
+            context.finishRun();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro durante teste de performance para " << result.structureType
+                      << " com " << data.size() << " elementos: " << e.what() << std::endl;
+            result.success = false;
+        }
+
+        return result;
+    }
+
+    /**
+     * Executa todas as combinações (Vector, List, Queue, Stack × Linear, Dynamic)
+     * Cada par repete run sobre a mesma estrutura até onRepetition devolver false
+     * @param data Dados de entrada
+     * @param onRepetition Chamado a cada repetição, na ordem da tabela de resumo
+     */
+    static void runAll(const std::vector<int> &data, const RepetitionCallback &onRepetition);
+
+private:
+    static Result emptyResult(const std::string &structureType, size_t dataSize);
+
+    template <template <typename> class Structure, typename Engine>
+    static void repeat(const std::vector<int> &data, const RepetitionCallback &onRepetition)
+    {
+        std::string structureType = std::string(Engine::name) + " " + Structure<Engine>::kind();
+        try
+        {
+            Structure<Engine> structure;
+            BenchmarkContext context(data.size());
+            while (onRepetition(run(structure, data, context)))
+            {
+            }
+        }
+        catch (const std::exception &e)
+        {
+            // Falha ao criar a estrutura ou reservar os buffers
+            std::cerr << "Erro durante teste de performance para " << structureType
+                      << " com " << data.size() << " elementos: " << e.what() << std::endl;
+            onRepetition(emptyResult(structureType, data.size()));
+        }
+    }
+
+    template <template <typename> class... Structures>
+    static void runEach(const std::vector<int> &data, const RepetitionCallback &onRepetition)
+    {
+        ((repeat<Structures, LinearEngine>(data, onRepetition),
+          repeat<Structures, DynamicEngine>(data, onRepetition)),
+         ...);
+    }
+};
+
+#endif // STATICBENCHMARK_HPP
@@ -0,0 +1,360 @@
+#ifndef STATICSTRUCTURES_HPP
+#define STATICSTRUCTURES_HPP
+
+#include "NodeArena.hpp"
+#include "AllocationTracker.hpp"
+#include <vector>
+#include <list>
+#include <queue>
+#include <stack>
+#include <cstring>
+#include <cstddef>
+
+/**
+ * Variantes das estruturas com despacho estático (CRTP)
+ * O modo (engine) é escolhido em tempo de compilação: não há chamadas
+ * virtuais nem testes de isDynamic dentro de insert().
+ *
+ * LinearEngine:  contêineres da STL (equivalente ao modo linear)
+ * DynamicEngine: armazenamento próprio (array ou nós encadeados em arena)
+ */
+struct LinearEngine
+{
+    static constexpr const char *name = "Linear";
+};
+
+struct DynamicEngine
+{
+    static constexpr const char *name = "Dynamic";
+};
+
+/**
+ * Interface comum resolvida em tempo de compilação
+ * Derived implementa insertImpl, clearImpl, sizeImpl, toVectorImpl e allocatedBytesImpl
+ */
+template <typename Derived>
+class StaticStructure
+{
+public:
+    void insert(int value) { self().insertImpl(value); }
+    void clear() { self().clearImpl(); }
+    size_t size() const { return self().sizeImpl(); }
+
+    void toVector(std::vector<int> &out) const
+    {
+        out.resize(size());
+        self().toVectorImpl(out.data());
+    }
+
+    void fromVector(const std::vector<int> &vec)
+    {
+        clear();
+        for (int value : vec)
+        {
+            self().insertImpl(value);
+        }
+    }
+
+    // Bytes alocados pela instância: contados pelo CountingAllocator nos
+    // contêineres da STL e pela capacidade real no armazenamento próprio
+    size_t memoryUsage() const { return self().allocatedBytesImpl(); }
+
+private:
+    Derived &self() { return static_cast<Derived &>(*this); }
+    const Derived &self() const { return static_cast<const Derived &>(*this); }
+};
+
+/**
+ * Cadeia simplesmente encadeada em arena, compartilhada pelas variantes dinâmicas
+ */
+class StaticNodeChain
+{
+public:
+    struct Node
+    {
+        int data;
+        Node *next;
+        Node(int value) : data(value), next(nullptr) {}
+    };
+
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    size_t count = 0;
+    NodeArena<Node> nodes;
+
+    void append(int value)
+    {
+        Node *newNode = nodes.create(value);
+        if (tail == nullptr)
+        {
+            head = newNode;
+        }
+        else
+        {
+            tail->next = newNode;
+        }
+        tail = newNode;
+        count++;
+    }
+
+    void prepend(int value)
+    {
+        Node *newNode = nodes.create(value);
+        newNode->next = head;
+        head = newNode;
+        if (tail == nullptr)
+        {
+            tail = newNode;
+        }
+        count++;
+    }
+
+    void reset()
+    {
+        nodes.releaseChain(head);
+        head = tail = nullptr;
+        count = 0;
+    }
+};
+
+// ========== Vetor ==========
+
+template <typename Engine>
+class StaticVector;
+
+template <>
+class StaticVector<LinearEngine> : public StaticStructure<StaticVector<LinearEngine>>
+{
+    AllocationCounter counter;
+    std::vector<int, CountingAllocator<int>> values{CountingAllocator<int>(&counter)};
+
+public:
+    static const char *kind() { return "Vector"; }
+
+    void insertImpl(int value) { values.push_back(value); }
+    size_t allocatedBytesImpl() const { return counter.liveBytes(); }
+    void clearImpl() { values.clear(); }
+    size_t sizeImpl() const { return values.size(); }
+    void toVectorImpl(int *out) const { std::memcpy(out, values.data(), values.size() * sizeof(int)); }
+};
+
+template <>
+class StaticVector<DynamicEngine> : public StaticStructure<StaticVector<DynamicEngine>>
+{
+    int *array = nullptr;
+    size_t capacity = 0;
+    size_t count = 0;
+
+public:
+    static const char *kind() { return "Vector"; }
+
+    StaticVector() = default;
+    StaticVector(const StaticVector &) = delete;
+    StaticVector &operator=(const StaticVector &) = delete;
+    ~StaticVector() { delete[] array; }
+
+    void insertImpl(int value)
+    {
+        if (count == capacity)
+        {
+            size_t newCapacity = capacity == 0 ? 16 : capacity * 2;
+            int *newArray = new int[newCapacity];
+            if (count > 0)
+            {
+                std::memcpy(newArray, array, count * sizeof(int));
+            }
+            delete[] array;
+            array = newArray;
+            capacity = newCapacity;
+        }
+        array[count++] = value;
+    }
+
+    void clearImpl() { count = 0; }
+    size_t sizeImpl() const { return count; }
+    size_t allocatedBytesImpl() const { return capacity * sizeof(int); }
+
+    void toVectorImpl(int *out) const
+    {
+        if (count > 0)
+        {
+            std::memcpy(out, array, count * sizeof(int));
+        }
+    }
+};
+
+// ========== Lista ==========
+
+template <typename Engine>
+class StaticList;
+
+template <>
+class StaticList<LinearEngine> : public StaticStructure<StaticList<LinearEngine>>
+{
+    AllocationCounter counter;
+    std::list<int, CountingAllocator<int>> values{CountingAllocator<int>(&counter)};
+
+public:
+    static const char *kind() { return "List"; }
+
+    void insertImpl(int value) { values.push_back(value); }
+    size_t allocatedBytesImpl() const { return counter.liveBytes(); }
+    void clearImpl() { values.clear(); }
+    size_t sizeImpl() const { return values.size(); }
+
+    void toVectorImpl(int *out) const
+    {
+        for (int value : values)
+        {
+            *out++ = value;
+        }
+    }
+};
+
+template <>
+class StaticList<DynamicEngine> : public StaticStructure<StaticList<DynamicEngine>>
+{
+    StaticNodeChain chain;
+
+public:
+    static const char *kind() { return "List"; }
+
+    ~StaticList() { chain.reset(); }
+
+    void insertImpl(int value) { chain.append(value); }
+    void clearImpl() { chain.reset(); }
+    size_t sizeImpl() const { return chain.count; }
+    size_t allocatedBytesImpl() const { return chain.nodes.reservedBytes(); }
+
+    void toVectorImpl(int *out) const
+    {
+        for (const StaticNodeChain::Node *node = chain.head; node != nullptr; node = node->next)
+        {
+            *out++ = node->data;
+        }
+    }
+};
+
+// ========== Fila ==========
+
+template <typename Engine>
+class StaticQueue;
+
+template <>
+class StaticQueue<LinearEngine> : public StaticStructure<StaticQueue<LinearEngine>>
+{
+    using Deque = std::deque<int, CountingAllocator<int>>;
+
+    // Acesso ao contêiner protegido da std::queue para percorrê-lo sem cópia
+    struct Queue : std::queue<int, Deque>
+    {
+        explicit Queue(AllocationCounter *counter) : std::queue<int, Deque>(Deque(CountingAllocator<int>(counter))) {}
+        const Deque &container() const { return c; }
+    };
+    AllocationCounter counter;
+    Queue values{&counter};
+
+public:
+    static const char *kind() { return "Queue"; }
+
+    void insertImpl(int value) { values.push(value); }
+    void clearImpl() { values = Queue(&counter); }
+    size_t allocatedBytesImpl() const { return counter.liveBytes(); }
+    size_t sizeImpl() const { return values.size(); }
+
+    void toVectorImpl(int *out) const
+    {
+        for (int value : values.container())
+        {
+            *out++ = value;
+        }
+    }
+};
+
+template <>
+class StaticQueue<DynamicEngine> : public StaticStructure<StaticQueue<DynamicEngine>>
+{
+    StaticNodeChain chain; // head = frente, tail = fim
+
+public:
+    static const char *kind() { return "Queue"; }
+
+    ~StaticQueue() { chain.reset(); }
+
+    void insertImpl(int value) { chain.append(value); }
+    void clearImpl() { chain.reset(); }
+    size_t sizeImpl() const { return chain.count; }
+    size_t allocatedBytesImpl() const { return chain.nodes.reservedBytes(); }
+
+    void toVectorImpl(int *out) const
+    {
+        for (const StaticNodeChain::Node *node = chain.head; node != nullptr; node = node->next)
+        {
+            *out++ = node->data;
+        }
+    }
+};
+
+// ========== Pilha ==========
+
+template <typename Engine>
+class StaticStack;
+
+template <>
+class StaticStack<LinearEngine> : public StaticStructure<StaticStack<LinearEngine>>
+{
+    using Deque = std::deque<int, CountingAllocator<int>>;
+
+    struct Stack : std::stack<int, Deque>
+    {
+        explicit Stack(AllocationCounter *counter) : std::stack<int, Deque>(Deque(CountingAllocator<int>(counter))) {}
+        const Deque &container() const { return c; }
+    };
+    AllocationCounter counter;
+    Stack values{&counter};
+
+public:
+    static const char *kind() { return "Stack"; }
+
+    void insertImpl(int value) { values.push(value); }
+    void clearImpl() { values = Stack(&counter); }
+    size_t allocatedBytesImpl() const { return counter.liveBytes(); }
+    size_t sizeImpl() const { return values.size(); }
+
+    // O contêiner já está na ordem de inserção (base → topo)
+    void toVectorImpl(int *out) const
+    {
+        for (int value : values.container())
+        {
+            *out++ = value;
+        }
+    }
+};
+
+template <>
+class StaticStack<DynamicEngine> : public StaticStructure<StaticStack<DynamicEngine>>
+{
+    StaticNodeChain chain; // head = topo
+
+public:
+    static const char *kind() { return "Stack"; }
+
+    ~StaticStack() { chain.reset(); }
+
+    void insertImpl(int value) { chain.prepend(value); }
+    void clearImpl() { chain.reset(); }
+    size_t sizeImpl() const { return chain.count; }
+    size_t allocatedBytesImpl() const { return chain.nodes.reservedBytes(); }
+
+    // Do topo para a base, preenchendo de trás para frente
+    void toVectorImpl(int *out) const
+    {
+        int *dest = out + chain.count;
+        for (const StaticNodeChain::Node *node = chain.head; node != nullptr; node = node->next)
+        {
+            *--dest = node->data;
+        }
+    }
+};
+
+#endif // STATICSTRUCTURES_HPP
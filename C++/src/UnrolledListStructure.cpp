@@ -0,0 +1,124 @@
+#include "UnrolledListStructure.hpp"
+#include <algorithm>
+#include <cstring>
+
+UnrolledListStructure::UnrolledListStructure(AllocationPolicy policy)
+    : DataStructure(true), head(nullptr), tail(nullptr), currentSize(0), nodes(policy)
+{
+}
+
+UnrolledListStructure::~UnrolledListStructure()
+{
+    nodes.releaseChain(head);
+}
+
+UnrolledListStructure::Node *UnrolledListStructure::appendNode()
+{
+    Node *newNode = nodes.create();
+
+    if (head == nullptr)
+    {
+        head = newNode;
+    }
+    else
+    {
+        tail->next = newNode;
+    }
+    tail = newNode;
+    return newNode;
+}
+
+void UnrolledListStructure::insert(int value)
+{
+    Node *node = tail;
+    if (node == nullptr || node->count == NODE_CAPACITY)
+    {
+        node = appendNode();
+    }
+    node->values[node->count++] = value;
+    currentSize++;
+}
+
+void UnrolledListStructure::clear()
+{
+    nodes.releaseChain(head);
+    head = nullptr;
+    tail = nullptr;
+    currentSize = 0;
+}
+
+std::vector<int> UnrolledListStructure::toVector() const
+{
+    std::vector<int> result;
+    toVector(result);
+    return result;
+}
+
+void UnrolledListStructure::toVector(std::vector<int> &out) const
+{
+    out.resize(currentSize);
+
+    int *dest = out.data();
+    for (const Node *current = head; current != nullptr; current = current->next)
+    {
+        std::memcpy(dest, current->values, current->count * sizeof(int));
+        dest += current->count;
+    }
+}
+
+void UnrolledListStructure::insertBatch(const int *values, size_t count)
+{
+    nodes.reserve((count + NODE_CAPACITY - 1) / NODE_CAPACITY + 1);
+
+    size_t offset = 0;
+    while (offset < count)
+    {
+        Node *node = tail;
+        if (node == nullptr || node->count == NODE_CAPACITY)
+        {
+            node = appendNode();
+        }
+        size_t chunk = std::min(NODE_CAPACITY - node->count, count - offset);
+        std::memcpy(node->values + node->count, values + offset, chunk * sizeof(int));
+        node->count += static_cast<uint32_t>(chunk);
+        offset += chunk;
+    }
+    currentSize += count;
+}
+
+void UnrolledListStructure::fromVector(const std::vector<int> &vec)
+{
+    clear();
+    insertBatch(vec.data(), vec.size());
+}
+
+void UnrolledListStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    for (const Node *current = head; current != nullptr; current = current->next)
+    {
+        visitor(current->values, current->count);
+    }
+}
+
+void UnrolledListStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    for (Node *current = head; current != nullptr; current = current->next)
+    {
+        visitor(current->values, current->count);
+    }
+}
+
+std::string UnrolledListStructure::getType() const
+{
+    return "Unrolled List";
+}
+
+size_t UnrolledListStructure::size() const
+{
+    return currentSize;
+}
+
+bool UnrolledListStructure::empty() const
+{
+    return currentSize == 0;
+}
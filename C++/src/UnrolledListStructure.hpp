@@ -0,0 +1,55 @@
+#ifndef UNROLLEDLISTSTRUCTURE_HPP
+#define UNROLLEDLISTSTRUCTURE_HPP
+
+#include "DataStructure.hpp"
+#include "NodeArena.hpp"
+#include <cstdint>
+
+/**
+ * Lista encadeada desenrolada: cada nó guarda um bloco de inteiros
+ * Nós de 128 bytes (par de linhas de cache buscado junto pelo prefetcher
+ * adjacente) com 29 valores, contra 4 bytes úteis a cada 16 na lista comum
+ */
+class UnrolledListStructure : public DataStructure
+{
+private:
+    static constexpr size_t NODE_BYTES = 128;
+    static constexpr size_t NODE_CAPACITY = (NODE_BYTES - sizeof(void *) - sizeof(uint32_t)) / sizeof(int);
+
+    struct alignas(64) Node
+    {
+        Node *next;
+        uint32_t count;
+        int values[NODE_CAPACITY];
+        Node() : next(nullptr), count(0) {}
+    };
+    static_assert(sizeof(Node) == NODE_BYTES, "Nó deve ocupar exatamente NODE_BYTES");
+
+    Node *head;
+    Node *tail;
+    size_t currentSize;
+    NodeArena<Node> nodes;
+
+public:
+    explicit UnrolledListStructure(AllocationPolicy policy = AllocationPolicy::Arena);
+    ~UnrolledListStructure() override;
+
+    size_t size() const override;
+    bool empty() const override;
+    void insert(int value) override;
+    void clear() override;
+    std::vector<int> toVector() const override;
+    void fromVector(const std::vector<int> &vec) override;
+    std::string getType() const override;
+
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    using DataStructure::fromVector;
+    void forEachChunk(const ChunkVisitor &visitor) const override;
+    void updateEachChunk(const MutableChunkVisitor &visitor) override;
+
+private:
+    Node *appendNode();
+};
+
+#endif // UNROLLEDLISTSTRUCTURE_HPP
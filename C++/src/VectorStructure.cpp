@@ -1,42 +1,141 @@
 #include "VectorStructure.hpp"
+#include "AllocationTracker.hpp"
 #include <algorithm>
+#include <cstring>
+#include <new>
 
-VectorStructure::VectorStructure(bool dynamic) : DataStructure(dynamic)
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+VectorStructure::VectorStructure(bool dynamic, const VectorGrowthPolicy &policy)
+    : DataStructure(dynamic), dynamicArray(nullptr), capacity(0), currentSize(0), growth(policy), mapped(false)
 {
+    growth.factor = std::max(growth.factor, 1.1);
+    growth.initialCapacity = std::max<size_t>(growth.initialCapacity, 1);
+
     if (isDynamic)
     {
-        capacity = 1;
-        currentSize = 0;
-        initializeDynamicArray();
+        reallocate(growth.initialCapacity);
     }
 }
 
 VectorStructure::~VectorStructure()
 {
-    if (isDynamic && dynamicArray)
+    releaseArray();
+}
+
+void VectorStructure::releaseArray()
+{
+#ifdef __linux__
+    if (mapped)
     {
-        delete[] dynamicArray;
+        munmap(dynamicArray, capacity * sizeof(int));
+        AllocationTracker::recordRelease(capacity * sizeof(int));
+        dynamicArray = nullptr;
+        mapped = false;
+        return;
     }
+#endif
+    delete[] dynamicArray;
+    dynamicArray = nullptr;
 }
 
-void VectorStructure::initializeDynamicArray()
+void VectorStructure::reallocate(size_t newCapacity)
 {
-    dynamicArray = new int[capacity];
+#ifdef __linux__
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t bytes = newCapacity * sizeof(int);
+
+    if (growth.mmapThresholdBytes > 0 && bytes >= growth.mmapThresholdBytes)
+    {
+        // Arredonda para páginas inteiras; a sobra vira capacidade
+        bytes = (bytes + pageSize - 1) / pageSize * pageSize;
+        void *memory;
+        if (mapped)
+        {
+            // O kernel remapeia as páginas existentes: nenhum elemento é copiado
+            memory = mremap(dynamicArray, capacity * sizeof(int), bytes, MREMAP_MAYMOVE);
+        }
+        else
+        {
+            memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory != MAP_FAILED && currentSize > 0)
+            {
+                std::memcpy(memory, dynamicArray, currentSize * sizeof(int));
+            }
+            if (memory != MAP_FAILED)
+            {
+                delete[] dynamicArray;
+            }
+        }
+        if (memory == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        // Páginas mapeadas não passam pelo operator new: contabiliza à parte
+        if (mapped)
+        {
+            AllocationTracker::recordRelease(capacity * sizeof(int));
+        }
+        AllocationTracker::recordAllocation(bytes);
+
+        dynamicArray = static_cast<int *>(memory);
+        capacity = bytes / sizeof(int);
+        mapped = true;
+        return;
+    }
+#endif
+
+    int *newArray = new int[newCapacity];
+    if (currentSize > 0)
+    {
+        std::memcpy(newArray, dynamicArray, currentSize * sizeof(int));
+    }
+
+    releaseArray();
+    dynamicArray = newArray;
+    capacity = newCapacity;
 }
 
 void VectorStructure::resize()
 {
-    size_t newCapacity = capacity * 2;
-    int *newArray = new int[newCapacity];
+    size_t newCapacity = static_cast<size_t>(static_cast<double>(capacity) * growth.factor);
+    reallocate(std::max(newCapacity, capacity + 1));
+}
 
-    for (size_t i = 0; i < currentSize; ++i)
+void VectorStructure::ensureCapacity(size_t minCapacity)
+{
+    if (minCapacity <= capacity)
     {
-        newArray[i] = dynamicArray[i];
+        return;
     }
 
-    delete[] dynamicArray;
-    dynamicArray = newArray;
-    capacity = newCapacity;
+    // Cresce pela política, mas nunca menos do que o pedido
+    size_t newCapacity = static_cast<size_t>(static_cast<double>(capacity) * growth.factor);
+    reallocate(std::max(newCapacity, minCapacity));
+}
+
+void VectorStructure::reserve(size_t minCapacity)
+{
+    if (isDynamic)
+    {
+        if (minCapacity > capacity)
+        {
+            reallocate(minCapacity);
+        }
+    }
+    else
+    {
+        data.reserve(minCapacity);
+    }
+}
+
+size_t VectorStructure::getCapacity() const
+{
+    return isDynamic ? capacity : data.capacity();
 }
 
 void VectorStructure::insert(int value)
@@ -85,17 +184,7 @@ void VectorStructure::fromVector(const std::vector<int> &vec)
 
     if (isDynamic)
     {
-        // Ajusta capacidade se necessário
-        while (capacity < vec.size())
-        {
-            resize();
-        }
-
-        for (size_t i = 0; i < vec.size(); ++i)
-        {
-            dynamicArray[i] = vec[i];
-        }
-        currentSize = vec.size();
+        insertBatch(vec.data(), vec.size());
     }
     else
     {
@@ -103,6 +192,79 @@ void VectorStructure::fromVector(const std::vector<int> &vec)
     }
 }
 
+void VectorStructure::insertBatch(const int *values, size_t count)
+{
+    if (isDynamic)
+    {
+        ensureCapacity(currentSize + count);
+        std::copy(values, values + count, dynamicArray + currentSize);
+        currentSize += count;
+    }
+    else
+    {
+        data.insert(data.end(), values, values + count);
+    }
+}
+
+void VectorStructure::toVector(std::vector<int> &out) const
+{
+    if (isDynamic)
+    {
+        out.assign(dynamicArray, dynamicArray + currentSize);
+    }
+    else
+    {
+        out.assign(data.begin(), data.end());
+    }
+}
+
+std::vector<int> VectorStructure::takeVector()
+{
+    if (isDynamic)
+    {
+        std::vector<int> result(dynamicArray, dynamicArray + currentSize);
+        currentSize = 0;
+        return result;
+    }
+
+    // Versão linear entrega o próprio armazenamento
+    std::vector<int> result = std::move(data);
+    data.clear();
+    return result;
+}
+
+void VectorStructure::fromVector(std::vector<int> &&vec)
+{
+    if (isDynamic)
+    {
+        fromVector(static_cast<const std::vector<int> &>(vec));
+    }
+    else
+    {
+        data = std::move(vec);
+    }
+}
+
+void VectorStructure::forEachChunk(const ChunkVisitor &visitor) const
+{
+    const int *values = isDynamic ? dynamicArray : data.data();
+    size_t count = isDynamic ? currentSize : data.size();
+    if (count > 0)
+    {
+        visitor(values, count);
+    }
+}
+
+void VectorStructure::updateEachChunk(const MutableChunkVisitor &visitor)
+{
+    int *values = isDynamic ? dynamicArray : data.data();
+    size_t count = isDynamic ? currentSize : data.size();
+    if (count > 0)
+    {
+        visitor(values, count);
+    }
+}
+
 std::string VectorStructure::getType() const
 {
     return isDynamic ? "Dynamic Vector" : "Linear Vector";
@@ -110,10 +272,10 @@ std::string VectorStructure::getType() const
 
 size_t VectorStructure::size() const
 {
-    return data.size();
+    return isDynamic ? currentSize : data.size();
 }
 
 bool VectorStructure::empty() const
 {
-    return data.empty();
+    return size() == 0;
 }
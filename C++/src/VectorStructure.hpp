@@ -4,6 +4,18 @@
 #include "DataStructure.hpp"
 #include <iostream>
 
+/**
+ * Política de crescimento do vetor dinâmico
+ * Acima de mmapThresholdBytes o armazenamento passa para páginas anônimas
+ * (mmap) que crescem com mremap, sem copiar os elementos
+ */
+struct VectorGrowthPolicy
+{
+    double factor = 2.0;                // Multiplicador da capacidade a cada crescimento
+    size_t initialCapacity = 16;        // Capacidade inicial em elementos
+    size_t mmapThresholdBytes = 1 << 20; // 0 desativa o uso de mmap
+};
+
 /**
  * Implementação de estrutura baseada em vetor
  * Suporta tanto versão linear quanto dinâmica
@@ -14,9 +26,11 @@ private:
     int *dynamicArray;
     size_t capacity;
     size_t currentSize;
+    VectorGrowthPolicy growth;
+    bool mapped; // dynamicArray vem de mmap (e não de new[])
 
 public:
-    explicit VectorStructure(bool dynamic = false);
+    explicit VectorStructure(bool dynamic = false, const VectorGrowthPolicy &policy = VectorGrowthPolicy());
     ~VectorStructure() override;
 
     void insert(int value) override;
@@ -25,12 +39,29 @@ public:
     void fromVector(const std::vector<int> &vec) override;
     std::string getType() const override;
 
-    size_t size() const;
-    bool empty() const;
+    void insertBatch(const int *values, size_t count) override;
+    void toVector(std::vector<int> &out) const override;
+    std::vector<int> takeVector() override;
+    void fromVector(std::vector<int> &&vec) override;
+    void forEachChunk(const ChunkVisitor &visitor) const override;
+    void updateEachChunk(const MutableChunkVisitor &visitor) override;
+
+    size_t size() const override;
+    bool empty() const override;
+
+    /**
+     * Dica de capacidade: garante espaço para ao menos minCapacity elementos
+     * sem realocações durante as próximas inserções
+     */
+    void reserve(size_t minCapacity);
+
+    size_t getCapacity() const;
 
 private:
     void resize();
-    void initializeDynamicArray();
+    void ensureCapacity(size_t minCapacity);
+    void reallocate(size_t newCapacity);
+    void releaseArray();
 };
 
 #endif // VECTORSTRUCTURE_HPP
\ No newline at end of file
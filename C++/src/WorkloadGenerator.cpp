@@ -0,0 +1,223 @@
+#include "WorkloadGenerator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace
+{
+    // Elementos por bloco com semente própria
+    constexpr size_t CHUNK_SIZE = 1 << 20;
+
+    // Limite da tabela acumulada do Zipf (32 MB de doubles)
+    constexpr size_t ZIPF_TABLE_LIMIT = 1 << 22;
+
+    struct SplitMix64
+    {
+        uint64_t state;
+
+        uint64_t next()
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+    };
+
+    // Inteiro em [0, range) sem divisão (multiplicação de Lemire)
+    inline uint64_t bounded(uint64_t random, uint64_t range)
+    {
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(random) * range) >> 64);
+    }
+
+    // value * numerator / denominator sem overflow intermediário
+    inline uint64_t scale(uint64_t value, uint64_t numerator, uint64_t denominator)
+    {
+        return static_cast<uint64_t>(static_cast<unsigned __int128>(value) * numerator / denominator);
+    }
+}
+
+WorkloadGenerator::Buffer<int> WorkloadGenerator::generate(const Config &config)
+{
+    Buffer<int> data(config.size);
+    fill(data.data(), config);
+    return data;
+}
+
+WorkloadGenerator::Buffer<int64_t> WorkloadGenerator::generate64(const Config &config)
+{
+    Buffer<int64_t> data(config.size);
+    fill(data.data(), config);
+    return data;
+}
+
+void WorkloadGenerator::fill(int *out, const Config &config)
+{
+    fillParallel(out, config);
+}
+
+void WorkloadGenerator::fill(int64_t *out, const Config &config)
+{
+    fillParallel(out, config);
+}
+
+std::vector<double> WorkloadGenerator::buildZipfTable(const Config &config)
+{
+    size_t ranks = static_cast<size_t>(std::max<int64_t>(config.maxValue, 1));
+    ranks = std::min(ranks, ZIPF_TABLE_LIMIT);
+
+    std::vector<double> cdf(ranks);
+    double sum = 0.0;
+    for (size_t k = 0; k < ranks; ++k)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(k + 1), config.zipfExponent);
+        cdf[k] = sum;
+    }
+    for (double &value : cdf)
+    {
+        value /= sum;
+    }
+    return cdf;
+}
+
+template <typename T>
+void WorkloadGenerator::fillParallel(T *out, const Config &config)
+{
+    const size_t n = config.size;
+    if (n == 0)
+    {
+        return;
+    }
+
+    const uint64_t typeMax = static_cast<uint64_t>(std::numeric_limits<T>::max());
+    const uint64_t maxValue = std::min<uint64_t>(static_cast<uint64_t>(std::max<int64_t>(config.maxValue, 0)), typeMax);
+    const uint64_t uniqueValues = std::max<uint64_t>(config.uniqueValues, 1);
+    const uint64_t period = std::max<uint64_t>(config.sawtoothPeriod, 1);
+
+    std::vector<double> zipfTable;
+    if (config.distribution == Distribution::Zipf)
+    {
+        zipfTable = buildZipfTable(config);
+    }
+
+    const size_t chunks = (n + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    unsigned threads = config.threads != 0 ? config.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::clamp<size_t>(threads, 1, chunks));
+
+    auto worker = [&](unsigned threadIndex)
+    {
+        for (size_t chunk = threadIndex; chunk < chunks; chunk += threads)
+        {
+            const size_t begin = chunk * CHUNK_SIZE;
+            const size_t end = std::min(n, begin + CHUNK_SIZE);
+            SplitMix64 rng{config.seed + 0x9E3779B97F4A7C15ULL * (chunk + 1)};
+
+            switch (config.distribution)
+            {
+            case Distribution::Uniform:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    out[i] = static_cast<T>(bounded(rng.next(), maxValue + 1));
+                }
+                break;
+
+            case Distribution::Zipf:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    double u = static_cast<double>(rng.next() >> 11) * 0x1.0p-53;
+                    size_t rank = std::upper_bound(zipfTable.begin(), zipfTable.end(), u) - zipfTable.begin();
+                    out[i] = static_cast<T>(std::min(rank, zipfTable.size() - 1) + 1);
+                }
+                break;
+
+            case Distribution::Sorted:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    out[i] = static_cast<T>(scale(i, maxValue + 1, n));
+                }
+                break;
+
+            case Distribution::Reverse:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    out[i] = static_cast<T>(maxValue - scale(i, maxValue + 1, n));
+                }
+                break;
+
+            case Distribution::FewUnique:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    uint64_t key = bounded(rng.next(), uniqueValues);
+                    out[i] = static_cast<T>(scale(key, maxValue, std::max<uint64_t>(uniqueValues - 1, 1)));
+                }
+                break;
+
+            case Distribution::Sawtooth:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    out[i] = static_cast<T>(scale(i % period, maxValue, std::max<uint64_t>(period - 1, 1)));
+                }
+                break;
+
+            case Distribution::WideRange:
+                for (size_t i = begin; i < end; ++i)
+                {
+                    out[i] = static_cast<T>(rng.next() & typeMax);
+                }
+                break;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+}
+
+const char *WorkloadGenerator::distributionName(Distribution distribution)
+{
+    switch (distribution)
+    {
+    case Distribution::Uniform:
+        return "uniform";
+    case Distribution::Zipf:
+        return "zipf";
+    case Distribution::Sorted:
+        return "sorted";
+    case Distribution::Reverse:
+        return "reverse";
+    case Distribution::FewUnique:
+        return "few-unique";
+    case Distribution::Sawtooth:
+        return "sawtooth";
+    case Distribution::WideRange:
+        return "wide-range";
+    default:
+        return "desconhecida";
+    }
+}
+
+bool WorkloadGenerator::parseDistribution(const std::string &name, Distribution &distribution)
+{
+    const Distribution all[] = {Distribution::Uniform, Distribution::Zipf, Distribution::Sorted,
+                                Distribution::Reverse, Distribution::FewUnique, Distribution::Sawtooth,
+                                Distribution::WideRange};
+    for (Distribution candidate : all)
+    {
+        if (name == distributionName(candidate))
+        {
+            distribution = candidate;
+            return true;
+        }
+    }
+    return false;
+}
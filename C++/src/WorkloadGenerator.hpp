@@ -0,0 +1,115 @@
+#ifndef WORKLOADGENERATOR_HPP
+#define WORKLOADGENERATOR_HPP
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Gerador de cargas sintéticas para os benchmarks
+ * Preenche buffers grandes em paralelo; cada bloco de elementos tem
+ * semente derivada de (seed, índice do bloco), então o resultado é
+ * o mesmo para qualquer número de threads.
+ */
+class WorkloadGenerator
+{
+public:
+    enum class Distribution
+    {
+        Uniform,   // Uniforme em [0, maxValue]
+        Zipf,      // Zipf com expoente zipfExponent sobre 1..maxValue
+        Sorted,    // Crescente de 0 a maxValue
+        Reverse,   // Decrescente de maxValue a 0
+        FewUnique, // uniqueValues chaves distintas espalhadas em [0, maxValue]
+        Sawtooth,  // Rampas crescentes de sawtoothPeriod elementos
+        WideRange  // Uniforme sobre todo o intervalo não negativo do tipo
+    };
+
+    /**
+     * Alocador que não inicializa os elementos ao redimensionar:
+     * o vetor nasce sem zerar as páginas e fill() faz o primeiro toque
+     */
+    template <typename T>
+    struct DefaultInitAllocator : std::allocator<T>
+    {
+        template <typename U>
+        struct rebind
+        {
+            using other = DefaultInitAllocator<U>;
+        };
+
+        DefaultInitAllocator() = default;
+        template <typename U>
+        DefaultInitAllocator(const DefaultInitAllocator<U> &) noexcept {}
+
+        template <typename U>
+        void construct(U *pointer)
+        {
+            ::new (static_cast<void *>(pointer)) U;
+        }
+
+        template <typename U, typename... Args>
+        void construct(U *pointer, Args &&...args)
+        {
+            ::new (static_cast<void *>(pointer)) U(std::forward<Args>(args)...);
+        }
+    };
+
+    template <typename T>
+    using Buffer = std::vector<T, DefaultInitAllocator<T>>;
+
+    struct Config
+    {
+        Distribution distribution = Distribution::Uniform;
+        size_t size = 0;
+        uint64_t seed = 42;
+        int64_t maxValue = 1000000;
+        double zipfExponent = 1.0;
+        size_t uniqueValues = 16;
+        size_t sawtoothPeriod = 1024;
+        unsigned threads = 0; // 0 = std::thread::hardware_concurrency()
+    };
+
+    /**
+     * Gera chaves de 32 bits; o buffer não é zerado antes do preenchimento paralelo
+     * @param config Distribuição, tamanho e semente
+     * @return Vetor com config.size elementos
+     */
+    static Buffer<int> generate(const Config &config);
+
+    /**
+     * Gera chaves de 64 bits (WideRange cobre [0, 2^63))
+     * @param config Distribuição, tamanho e semente
+     * @return Vetor com config.size elementos
+     */
+    static Buffer<int64_t> generate64(const Config &config);
+
+    /**
+     * Preenche um buffer já alocado; usado sem inicialização prévia,
+     * o primeiro toque de cada página acontece na thread que a preenche
+     * @param out Destino com pelo menos config.size elementos
+     * @param config Distribuição, tamanho e semente
+     */
+    static void fill(int *out, const Config &config);
+    static void fill(int64_t *out, const Config &config);
+
+    static const char *distributionName(Distribution distribution);
+
+    /**
+     * Converte o nome (ex.: "zipf") na distribuição correspondente
+     * @return false se o nome não for reconhecido
+     */
+    static bool parseDistribution(const std::string &name, Distribution &distribution);
+
+private:
+    template <typename T>
+    static void fillParallel(T *out, const Config &config);
+
+    static std::vector<double> buildZipfTable(const Config &config);
+};
+
+#endif // WORKLOADGENERATOR_HPP
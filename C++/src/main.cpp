@@ -7,76 +7,109 @@
 #include <iomanip>
 #include <map>
 #include <functional>
+#include <cctype>
+#include <thread>
 
 #include "DataStructure.hpp"
 #include "VectorStructure.hpp"
 #include "ListStructure.hpp"
 #include "QueueStructure.hpp"
 #include "StackStructure.hpp"
+#include "UnrolledListStructure.hpp"
 #include "CountingSort.hpp"
 #include "CSVReader.hpp"
 #include "PerformanceAnalyzer.hpp"
+#include "RecordSampler.hpp"
+#include "WorkloadGenerator.hpp"
+#include "OutputWriter.hpp"
+#include "StaticBenchmark.hpp"
+#include "AllocationTracker.hpp"
+#include "BenchmarkContext.hpp"
+#include "BenchmarkStatistics.hpp"
+#include "PerfCounters.hpp"
+#include "BenchmarkClock.hpp"
+#include "RadixSort.hpp"
 
 #define ARQUIVO_ENTRADA "datasets/ratings.csv"
 
 const std::vector<size_t> VOLUMES_TESTE = {100, 1000, 10000, 100000, 1000000};
-const int NUM_REPETICOES = 10;
+// Repetições: 1 fria, NUM_AQUECIMENTO descartadas e então amostras quentes
+// até a meia largura do IC 95% da média ficar abaixo de IC_RELATIVO_ALVO
+const size_t NUM_AQUECIMENTO = 2;
+const size_t MIN_REPETICOES = 5;
+const size_t MAX_REPETICOES = 50;
+const double IC_RELATIVO_ALVO = 0.05;
+
+// Como cada volume é extraído do dataset (Head = prefixo do arquivo, ordenado por userId)
+const RecordSampler::Mode MODO_AMOSTRAGEM = RecordSampler::Mode::Reservoir;
+const uint64_t SEMENTE_AMOSTRAGEM = 42;
 
 void exibirTabelaResumoFinal(
+    const std::vector<size_t> &volumes,
     const std::map<std::string, std::map<size_t, double>> &temposMedios,
-    const std::map<std::string, std::map<size_t, size_t>> &memoriasEstimadas)
+    const std::map<std::string, std::map<size_t, double>> &temposFrios,
+    const std::map<std::string, std::map<size_t, size_t>> &memoriasMedidas)
 {
     std::cout << "\n\n";
     std::cout << "                                         TABELA RESUMO FINAL\n";
     std::cout << "============================================================================================================\n";
     std::cout << std::left << std::setw(22) << "Estrutura" << " | "
               << std::left << std::setw(10) << "Tipo" << " |";
-    for (size_t volume : VOLUMES_TESTE)
+    for (size_t volume : volumes)
     {
         std::cout << std::right << std::setw(10) << volume << " |";
     }
     std::cout << "\n------------------------------------------------------------------------------------------------------------\n";
-    std::cout << "\nTEMPO (ms):\n";
     std::vector<std::string> structureNames = {
-        "Linear Vector", "Dynamic Vector",
-        "Linear List", "Dynamic List",
-        "Linear Queue", "Dynamic Queue",
-        "Linear Stack", "Dynamic Stack"};
+        "Linear Vector", "Dynamic Vector", "Packed Vector",
+        "Linear List", "Dynamic List", "Dynamic List (malloc)", "Unrolled List",
+        "Linear Queue", "Dynamic Queue", "Dynamic Queue (malloc)", "Ring Queue", "Concurrent Queue",
+        "Linear Stack", "Dynamic Stack", "Dynamic Stack (malloc)", "Concurrent Stack"};
 
-    for (const std::string &name : structureNames)
+    auto exibirTempos = [&](const std::map<std::string, std::map<size_t, double>> &tempos)
     {
-        if (temposMedios.count(name) == 0)
-            continue;
-        std::string type = (name.find("Linear") != std::string::npos) ? "linear" : "dynamic";
-        std::cout << std::left << std::setw(22) << name << " | "
-                  << std::left << std::setw(10) << type << " |";
-        for (size_t volume : VOLUMES_TESTE)
+        for (const std::string &name : structureNames)
         {
-            if (temposMedios.at(name).count(volume) && temposMedios.at(name).at(volume) >= 0)
+            if (tempos.count(name) == 0)
+                continue;
+            std::string type = (name.find("Linear") != std::string::npos) ? "linear" : "dynamic";
+            std::cout << std::left << std::setw(22) << name << " | "
+                      << std::left << std::setw(10) << type << " |";
+            for (size_t volume : volumes)
             {
-                std::cout << std::fixed << std::setprecision(2)
-                          << std::right << std::setw(10) << temposMedios.at(name).at(volume) << " |";
-            }
-            else
-            {
-                std::cout << std::right << std::setw(10) << "FALHA" << " |";
+                if (tempos.at(name).count(volume) && tempos.at(name).at(volume) >= 0)
+                {
+                    std::cout << std::fixed << std::setprecision(2)
+                              << std::right << std::setw(10) << tempos.at(name).at(volume) << " |";
+                }
+                else
+                {
+                    std::cout << std::right << std::setw(10) << "FALHA" << " |";
+                }
             }
+            std::cout << "\n";
         }
-        std::cout << "\n";
-    }
-    std::cout << "\nMEMORIA (MB):\n";
+    };
+
+    // Quente: mediana das repetições com buffers e estrutura reaproveitados
+    std::cout << "\nTEMPO QUENTE - MEDIANA (ms):\n";
+    exibirTempos(temposMedios);
+    // Fria: primeira repetição, incluindo o primeiro toque nas páginas
+    std::cout << "\nTEMPO FRIO (ms):\n";
+    exibirTempos(temposFrios);
+    std::cout << "\nMEMORIA MEDIDA (MB):\n";
     for (const std::string &name : structureNames)
     {
-        if (memoriasEstimadas.count(name) == 0)
+        if (memoriasMedidas.count(name) == 0)
             continue;
         std::string type = (name.find("Linear") != std::string::npos) ? "linear" : "dynamic";
         std::cout << std::left << std::setw(22) << name << " | "
                   << std::left << std::setw(10) << type << " |";
-        for (size_t volume : VOLUMES_TESTE)
+        for (size_t volume : volumes)
         {
-            if (memoriasEstimadas.at(name).count(volume) && memoriasEstimadas.at(name).at(volume) > 0)
+            if (memoriasMedidas.at(name).count(volume) && memoriasMedidas.at(name).at(volume) > 0)
             {
-                double memoria_mb = static_cast<double>(memoriasEstimadas.at(name).at(volume)) / (1024.0 * 1024.0);
+                double memoria_mb = static_cast<double>(memoriasMedidas.at(name).at(volume)) / (1024.0 * 1024.0);
                 std::cout << std::fixed << std::setprecision(2)
                           << std::right << std::setw(10) << memoria_mb << " |";
             }
@@ -90,101 +123,646 @@ void exibirTabelaResumoFinal(
     std::cout << "============================================================================================================\n";
 }
 
-int main()
+void exibirResumo(const BenchmarkStatistics::Summary &resumo, double tempoFrioMs)
+{
+    std::cout << std::fixed << std::setprecision(2)
+              << "Mediana: " << resumo.median << " ms (min " << resumo.min
+              << ", p90 " << resumo.p90 << ", p99 " << resumo.p99
+              << ", σ " << resumo.stddev << ", IC ±" << resumo.relativeCI * 100.0
+              << "%, n=" << resumo.samples << ") Fria: " << tempoFrioMs << " ms";
+    if (resumo.outliers > 0)
+    {
+        std::cout << " ⚠️  " << resumo.outliers << " outlier(s)";
+    }
+    if (!resumo.converged)
+    {
+        std::cout << " ⚠️  IC alvo não atingido";
+    }
+}
+
+void exibirTabelaEstatisticas(
+    const std::vector<size_t> &volumes,
+    const std::string &motor,
+    const std::map<std::string, std::map<size_t, BenchmarkStatistics::Summary>> &estatisticas)
+{
+    std::cout << "\n                                    ESTATÍSTICAS DAS REPETIÇÕES QUENTES (ms)\n";
+    std::cout << "============================================================================================================\n";
+    std::cout << std::left << std::setw(22) << "Estrutura" << " | " << std::setw(8) << "Motor" << " |"
+              << std::right << std::setw(9) << "Volume" << " |" << std::setw(4) << "n" << " |"
+              << std::setw(9) << "Min" << " |" << std::setw(9) << "Mediana" << " |"
+              << std::setw(9) << "p90" << " |" << std::setw(9) << "p99" << " |"
+              << std::setw(9) << "σ" << " |" << std::setw(8) << "IC ±%" << " |" << std::setw(5) << "Out" << " |\n";
+    std::cout << "------------------------------------------------------------------------------------------------------------\n";
+    for (const auto &porEstrutura : estatisticas)
+    {
+        for (size_t volume : volumes)
+        {
+            if (porEstrutura.second.count(volume) == 0)
+                continue;
+            const BenchmarkStatistics::Summary &resumo = porEstrutura.second.at(volume);
+            std::cout << std::left << std::setw(22) << porEstrutura.first << " | " << std::setw(8) << motor << " |"
+                      << std::right << std::setw(9) << volume << " |" << std::setw(4) << resumo.samples << " |"
+                      << std::fixed << std::setprecision(3)
+                      << std::setw(9) << resumo.min << " |" << std::setw(9) << resumo.median << " |"
+                      << std::setw(9) << resumo.p90 << " |" << std::setw(9) << resumo.p99 << " |"
+                      << std::setw(9) << resumo.stddev << " |" << std::setprecision(1)
+                      << std::setw(8) << resumo.relativeCI * 100.0 << " |" << std::setw(5) << resumo.outliers << " |"
+                      << (resumo.converged ? "" : " *") << "\n";
+        }
+    }
+    std::cout << "* IC alvo não atingido dentro do máximo de repetições\n";
+    std::cout << "============================================================================================================\n";
+}
+
+// Contadores das quatro fases (carga, conversão, ordenação, volta) de uma repetição quente
+struct ContadoresFases
+{
+    PerfCounters::Sample fases[4];
+};
+
+void exibirTabelaContadores(
+    size_t volume,
+    const std::map<std::string, std::map<size_t, ContadoresFases>> &contadores)
+{
+    const char *nomesFases[] = {"carga", "toVector", "ordenação", "fromVector"};
+
+    std::cout << "\n                       CONTADORES DE HARDWARE POR FASE (" << volume << " elementos, por elemento)\n";
+    std::cout << "============================================================================================================\n";
+    std::cout << std::left << std::setw(22) << "Estrutura" << " | " << std::setw(10) << "Fase" << " |"
+              << std::right << std::setw(7) << "IPC" << " |" << std::setw(10) << "Ciclos" << " |"
+              << std::setw(10) << "L1d" << " |" << std::setw(10) << "LLC" << " |"
+              << std::setw(10) << "dTLB" << " |" << std::setw(10) << "Desvios" << " |\n";
+    std::cout << "------------------------------------------------------------------------------------------------------------\n";
+
+    auto exibirPorElemento = [volume](const PerfCounters::Sample &amostra, PerfCounters::Event evento)
+    {
+        double valor = amostra.perElement(evento, volume);
+        if (valor < 0)
+        {
+            std::cout << std::setw(10) << "N/A" << " |";
+        }
+        else
+        {
+            std::cout << std::setw(10) << valor << " |";
+        }
+    };
+
+    for (const auto &porEstrutura : contadores)
+    {
+        if (porEstrutura.second.count(volume) == 0)
+            continue;
+        const ContadoresFases &medidos = porEstrutura.second.at(volume);
+        for (int fase = 0; fase < 4; ++fase)
+        {
+            const PerfCounters::Sample &amostra = medidos.fases[fase];
+            // Fases que não rodaram no modo escolhido (ex.: conversões no --no-lugar)
+            if (!amostra.any())
+                continue;
+            std::cout << std::left << std::setw(22) << porEstrutura.first << " | " << std::setw(10) << nomesFases[fase] << " |"
+                      << std::right << std::fixed << std::setprecision(2) << std::setw(7) << amostra.ipc() << " |"
+                      << std::setprecision(3);
+            exibirPorElemento(amostra, PerfCounters::Cycles);
+            exibirPorElemento(amostra, PerfCounters::L1DMisses);
+            exibirPorElemento(amostra, PerfCounters::LLCMisses);
+            exibirPorElemento(amostra, PerfCounters::DTLBMisses);
+            exibirPorElemento(amostra, PerfCounters::BranchMisses);
+            std::cout << "\n";
+        }
+    }
+    std::cout << "============================================================================================================\n";
+}
+
+/**
+ * Faixa larga de 64 bits: as estruturas guardam int e o CountingSort teria um
+ * histograma do tamanho da amplitude, então as chaves vêm de generate64 e são
+ * ordenadas pelo RadixSort (memória de contagem fixa)
+ * @return Código de saída do programa
+ */
+int executarFaixaLarga(const WorkloadGenerator::Config &config, const std::vector<size_t> &volumes,
+                       const BenchmarkStatistics::Config &configEstatistica)
+{
+    uint64_t inicioGeracao = BenchmarkClock::now();
+    WorkloadGenerator::Buffer<int64_t> chaves = WorkloadGenerator::generate64(config);
+    uint64_t fimGeracao = BenchmarkClock::now();
+    std::cout << "Total de chaves geradas: " << chaves.size() << " em " << std::fixed << std::setprecision(2)
+              << BenchmarkClock::elapsed(inicioGeracao, fimGeracao).count() / 1000000.0 << " ms\n";
+
+    std::cout << "\n🔢 Radix sort LSD de 64 bits (4 dígitos de 16 bits):\n";
+    std::cout << std::right << std::setw(12) << "Volume" << " |" << std::setw(14) << "Mediana (ms)"
+              << " |" << std::setw(12) << "p90 (ms)" << " |" << std::setw(10) << "IC (%)"
+              << " |" << std::setw(6) << "n" << " |" << std::setw(12) << "Melem/s" << " |\n";
+
+    WorkloadGenerator::Buffer<int64_t> trabalho;
+    WorkloadGenerator::Buffer<int64_t> auxiliar;
+    bool sucesso = true;
+    for (size_t volume : volumes)
+    {
+        if (volume > chaves.size())
+        {
+            continue;
+        }
+        trabalho.resize(volume);
+        auxiliar.resize(volume);
+
+        BenchmarkStatistics estatisticas(configEstatistica);
+        bool ordenado = true;
+        do
+        {
+            std::copy(chaves.begin(), chaves.begin() + volume, trabalho.begin());
+            uint64_t inicio = BenchmarkClock::now();
+            RadixSort::sort(trabalho.data(), volume, auxiliar.data());
+            uint64_t fim = BenchmarkClock::now();
+            ordenado = ordenado && RadixSort::isSorted(trabalho.data(), volume);
+            estatisticas.add(BenchmarkClock::elapsed(inicio, fim).count() / 1000000.0);
+        } while (!estatisticas.done());
+
+        BenchmarkStatistics::Summary resumo = estatisticas.summarize();
+        std::cout << std::setw(12) << volume << " |" << std::setw(14) << resumo.median << " |"
+                  << std::setw(12) << resumo.p90 << " |" << std::setw(10) << resumo.relativeCI * 100.0 << " |"
+                  << std::setw(6) << resumo.samples << " |"
+                  << std::setw(12) << (resumo.median > 0.0 ? volume / (resumo.median * 1000.0) : 0.0) << " |"
+                  << (ordenado ? "" : " ❌ resultado incorreto") << "\n";
+        sucesso = sucesso && ordenado;
+    }
+    return sucesso ? 0 : 1;
+}
+
+void exibirUso(const char *programa)
 {
+    std::cerr << "Uso: " << programa << " [--sintetico <distribuicao> [tamanho] [semente]]"
+              << " [--saida <arquivo> [bin|csv] [threads]] [--no-lugar | --religar] [--estatico] [--comprimir]"
+              << " [--precisao <ic%> [max]] [--contadores] [--tsc] [--async]\n"
+              << "       " << programa << " --autoteste\n"
+              << "       " << programa << " --concorrente [threads] [lote]\n"
+              << "Distribuições: uniform, zipf, sorted, reverse, few-unique, sawtooth, wide-range\n"
+              << "  (wide-range gera chaves de 64 bits e mede só o RadixSort, sem as estruturas)\n";
+}
+
+int main(int argc, char *argv[])
+{
+    // Carga sintética opcional no lugar do dataset
+    bool usarSintetico = false;
+    WorkloadGenerator::Config configSintetica;
+    configSintetica.size = VOLUMES_TESTE.back();
+    configSintetica.seed = SEMENTE_AMOSTRAGEM;
+
+    // Gravação opcional dos dados ordenados
+    std::string arquivoSaida;
+    OutputWriter::Options opcoesSaida;
+
+    // Ordenação direta no armazenamento das estruturas, sem cópia para vetor
+    PerformanceAnalyzer::SortMode modoOrdenacao = PerformanceAnalyzer::SortMode::Copy;
+
+    // Variantes com despacho estático (StaticBenchmark) no lugar das fábricas virtuais
+    bool despachoEstatico = false;
+
+    // Ordenação emitida também numa CompressedSortedSequence (tamanho compactado)
+    bool saidaComprimida = false;
+
+    // Critério de parada das repetições
+    BenchmarkStatistics::Config configEstatistica;
+    configEstatistica.warmup = NUM_AQUECIMENTO;
+    configEstatistica.minSamples = MIN_REPETICOES;
+    configEstatistica.maxSamples = MAX_REPETICOES;
+    configEstatistica.targetRelativeCI = IC_RELATIVO_ALVO;
+
+    // Contadores de hardware por fase (perf_event_open)
+    bool usarContadores = false;
+
+    // Fases cronometradas pelo TSC calibrado em vez do steady_clock
+    bool usarTSC = false;
+
+    // Leitura do CSV simples em blocos via io_uring (O_DIRECT) em vez de std::getline
+    bool leituraAssincrona = false;
+
+    // Só confere a ordenação de todas as estruturas e modos, sem medir
+    bool autoteste = false;
+
+    // Modo de vazão com múltiplos produtores na ConcurrentQueueStructure
+    unsigned produtoresConcorrentes = 0;
+    bool insercaoEmLote = false;
+
+    auto ehNumero = [](const char *arg)
+    { return arg[0] != '\0' && std::all_of(arg, arg + std::char_traits<char>::length(arg), ::isdigit); };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--sintetico" && i + 1 < argc &&
+            WorkloadGenerator::parseDistribution(argv[i + 1], configSintetica.distribution))
+        {
+            usarSintetico = true;
+            i++;
+            if (i + 1 < argc && ehNumero(argv[i + 1]))
+                configSintetica.size = std::stoull(argv[++i]);
+            if (i + 1 < argc && ehNumero(argv[i + 1]))
+                configSintetica.seed = std::stoull(argv[++i]);
+        }
+        else if (arg == "--saida" && i + 1 < argc)
+        {
+            arquivoSaida = argv[++i];
+            if (i + 1 < argc && OutputWriter::parseFormat(argv[i + 1], opcoesSaida.format))
+                i++;
+            if (i + 1 < argc && ehNumero(argv[i + 1]))
+                opcoesSaida.threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        }
+        else if (arg == "--no-lugar")
+        {
+            modoOrdenacao = PerformanceAnalyzer::SortMode::InPlace;
+        }
+        else if (arg == "--religar")
+        {
+            modoOrdenacao = PerformanceAnalyzer::SortMode::Relink;
+        }
+        else if (arg == "--estatico")
+        {
+            despachoEstatico = true;
+        }
+        else if (arg == "--comprimir")
+        {
+            saidaComprimida = true;
+        }
+        else if (arg == "--contadores")
+        {
+            usarContadores = true;
+        }
+        else if (arg == "--tsc")
+        {
+            usarTSC = true;
+        }
+        else if (arg == "--async")
+        {
+            leituraAssincrona = true;
+        }
+        else if (arg == "--autoteste")
+        {
+            autoteste = true;
+        }
+        else if (arg == "--precisao" && i + 1 < argc)
+        {
+            configEstatistica.targetRelativeCI = std::stod(argv[++i]) / 100.0;
+            if (i + 1 < argc && ehNumero(argv[i + 1]))
+                configEstatistica.maxSamples = std::max<size_t>(std::stoull(argv[++i]), configEstatistica.minSamples);
+        }
+        else if (arg == "--concorrente")
+        {
+            produtoresConcorrentes = std::max(1u, std::thread::hardware_concurrency());
+            if (i + 1 < argc && ehNumero(argv[i + 1]))
+                produtoresConcorrentes = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (i + 1 < argc && std::string(argv[i + 1]) == "lote")
+            {
+                insercaoEmLote = true;
+                i++;
+            }
+        }
+        else
+        {
+            exibirUso(argv[0]);
+            return 1;
+        }
+    }
+
+    if (autoteste)
+    {
+        size_t falhas = PerformanceAnalyzer().runSelfCheck();
+        if (falhas == 0)
+        {
+            std::cout << "✅ Autoteste: todas as estruturas ordenaram corretamente nos três modos\n";
+            return 0;
+        }
+        std::cerr << "❌ Autoteste: " << falhas << " falha(s)\n";
+        return 1;
+    }
+
+    // Identifica a variante medida nas estatísticas
+    std::string motor = despachoEstatico ? "estatico"
+                        : modoOrdenacao == PerformanceAnalyzer::SortMode::InPlace ? "no-lugar"
+                        : modoOrdenacao == PerformanceAnalyzer::SortMode::Relink  ? "religar"
+                                                                                  : "copia";
+
+    std::vector<size_t> volumes = VOLUMES_TESTE;
+    if (usarSintetico && configSintetica.size > volumes.back())
+    {
+        volumes.push_back(configSintetica.size);
+    }
+
+    // Dados sintéticos já têm o formato desejado; o dataset é amostrado
+    RecordSampler::Mode modoAmostragem = usarSintetico ? RecordSampler::Mode::Head : MODO_AMOSTRAGEM;
+
+    if (usarTSC && !BenchmarkClock::enableTSC())
+    {
+        std::cout << "⚠️  CPU sem TSC invariante; usando steady_clock\n";
+    }
+
     std::cout << "\n";
     std::cout << "╔═══════════════════════════════════════════════════════════════════════════════════════╗\n";
     std::cout << "║                 ANÁLISE DE DESEMPENHO - ESTRUTURAS DE DADOS (LINGUAGEM C++)               ║\n";
     std::cout << "║                                     COUNTING SORT                                     ║\n";
     std::cout << "╚═══════════════════════════════════════════════════════════════════════════════════════╝\n";
-    std::cout << "📁 Arquivo: " << ARQUIVO_ENTRADA << std::endl;
+    if (usarSintetico)
+    {
+        std::cout << "🧪 Carga sintética: " << WorkloadGenerator::distributionName(configSintetica.distribution)
+                  << " (semente " << configSintetica.seed << ")" << std::endl;
+    }
+    else
+    {
+        std::cout << "📁 Arquivo: " << ARQUIVO_ENTRADA
+                  << (leituraAssincrona ? " (leitura assíncrona em blocos)" : "") << std::endl;
+    }
+    if (!arquivoSaida.empty())
+    {
+        std::cout << "💾 Saída ordenada: " << arquivoSaida
+                  << (opcoesSaida.format == OutputWriter::Format::CSV ? " (csv)" : " (bin)") << std::endl;
+    }
     std::cout << "📊 Volumes de teste: ";
-    for (size_t volume : VOLUMES_TESTE)
+    for (size_t volume : volumes)
         std::cout << volume << " ";
     std::cout << "\n";
-    std::cout << "🔄 Repetições por teste: " << NUM_REPETICOES << "\n\n";
+    std::cout << "🔄 Repetições por teste: 1 fria + " << configEstatistica.warmup << " de aquecimento + "
+              << configEstatistica.minSamples << " a " << configEstatistica.maxSamples
+              << " quentes (IC 95% alvo: ±" << configEstatistica.targetRelativeCI * 100.0 << "% da média)\n";
+    if (modoOrdenacao == PerformanceAnalyzer::SortMode::InPlace)
+    {
+        std::cout << "📌 Ordenação no lugar (sem conversão para vetor)\n";
+    }
+    else if (modoOrdenacao == PerformanceAnalyzer::SortMode::Relink)
+    {
+        std::cout << "📌 Ordenação por religação de nós (estruturas encadeadas)\n";
+    }
+    if (saidaComprimida)
+    {
+        std::cout << "🗜️  Saída ordenada também em sequência compactada (delta + bit-packing)\n";
+    }
+    if (despachoEstatico)
+    {
+        std::cout << "⚙️  Despacho estático (CRTP): estruturas e modos resolvidos em compilação\n";
+    }
+    std::cout << "⏱️  Relógio: " << BenchmarkClock::sourceName();
+    if (BenchmarkClock::source() == BenchmarkClock::Source::TSC)
+    {
+        std::cout << " a " << std::fixed << std::setprecision(3) << BenchmarkClock::ticksPerSecond() / 1e9
+                  << " GHz" << std::defaultfloat << std::setprecision(6);
+    }
+    std::cout << " (overhead ~" << BenchmarkClock::overhead().count() << " ns por medição)\n";
+    std::cout << "🎲 Amostragem: " << RecordSampler::modeName(modoAmostragem)
+              << " (semente " << SEMENTE_AMOSTRAGEM << ")\n\n";
 
-    CSVReader reader(ARQUIVO_ENTRADA);
-    if (!reader.isValidFile())
+    if (usarSintetico && configSintetica.distribution == WorkloadGenerator::Distribution::WideRange)
     {
-        std::cerr << "Erro: Arquivo de entrada '" << ARQUIVO_ENTRADA << "' não encontrado ou inválido.\n";
-        return 1;
+        return executarFaixaLarga(configSintetica, volumes, configEstatistica);
+    }
+
+    // Dados sintéticos ficam no buffer gerado (sem cópia); os lidos do CSV no vetor
+    WorkloadGenerator::Buffer<int> ratingsGerados;
+    std::vector<int> ratingsLidos;
+    if (usarSintetico)
+    {
+        ratingsGerados = WorkloadGenerator::generate(configSintetica);
     }
+    else
+    {
+        CSVReader reader(ARQUIVO_ENTRADA);
+        if (!reader.isValidFile())
+        {
+            std::cerr << "Erro: Arquivo de entrada '" << ARQUIVO_ENTRADA << "' não encontrado ou inválido.\n";
+            return 1;
+        }
+        if (leituraAssincrona)
+        {
+            reader.setIOMode(CSVReader::IOMode::Async);
+        }
 
-    std::vector<int> allRatings = reader.readMovieIds(0);
+        ratingsLidos = reader.readMovieIds(0);
+    }
+    const int *allRatings = usarSintetico ? ratingsGerados.data() : ratingsLidos.data();
+    const size_t totalRatings = usarSintetico ? ratingsGerados.size() : ratingsLidos.size();
 
-    if (allRatings.empty())
+    if (totalRatings == 0)
     {
         std::cerr << "Nenhum dado foi lido do arquivo. Saindo.\n";
         return 1;
     }
-    std::cout << "Total de ratings lidos: " << allRatings.size() << std::endl;
+    std::cout << "Total de ratings lidos: " << totalRatings << std::endl;
+
+    if (produtoresConcorrentes > 0)
+    {
+        try
+        {
+            PerformanceAnalyzer analisadorConcorrente;
+            std::cout << "\n🧵 Inserção concorrente (" << (insercaoEmLote ? "insertBatch" : "insert") << ") com "
+                      << totalRatings << " elementos:\n";
+            std::cout << std::right << std::setw(10) << "Threads" << " |" << std::setw(14) << "Inserção (ms)"
+                      << " |" << std::setw(14) << "Drain (ms)" << " |" << std::setw(12) << "Mops/s" << " |\n";
+            for (const auto &res : analisadorConcorrente.runConcurrentInsertTest(allRatings, totalRatings, produtoresConcorrentes, insercaoEmLote))
+            {
+                std::cout << std::setw(10) << res.producers << " |" << std::fixed << std::setprecision(2)
+                          << std::setw(14) << res.insertTime.count() / 1000000.0 << " |"
+                          << std::setw(14) << res.drainTime.count() / 1000000.0 << " |"
+                          << std::setw(12) << res.throughput << " |"
+                          << (res.success ? "" : " ❌ resultado incorreto") << "\n";
+            }
+
+            std::cout << "\n🧵 Contenção na pilha de Treiber (" << (insercaoEmLote ? "pushBatch/popBatch" : "push/pop")
+                      << ") com " << totalRatings << " elementos:\n";
+            std::cout << std::right << std::setw(10) << "Threads" << " |" << std::setw(14) << "Operações"
+                      << " |" << std::setw(14) << "Tempo (ms)" << " |" << std::setw(12) << "Mops/s" << " |\n";
+            for (const auto &res : analisadorConcorrente.runStackContentionTest(allRatings, totalRatings, produtoresConcorrentes, insercaoEmLote))
+            {
+                std::cout << std::setw(10) << res.threads << " |" << std::fixed << std::setprecision(2)
+                          << std::setw(14) << res.operations << " |"
+                          << std::setw(14) << res.time.count() / 1000000.0 << " |"
+                          << std::setw(12) << res.throughput << " |"
+                          << (res.success ? "" : " ❌ resultado incorreto") << "\n";
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro no teste concorrente: " << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
 
     std::map<std::string, std::map<size_t, double>> resultadosTempoMedio;
-    std::map<std::string, std::map<size_t, size_t>> resultadosMemoriaEstimada;
+    std::map<std::string, std::map<size_t, double>> resultadosTempoFrio;
+    std::map<std::string, std::map<size_t, size_t>> resultadosMemoriaMedida;
+    std::map<std::string, std::map<size_t, BenchmarkStatistics::Summary>> resultadosEstatisticas;
+    std::map<std::string, std::map<size_t, ContadoresFases>> resultadosContadores;
+    size_t maiorVolumeTestado = 0;
 
     PerformanceAnalyzer analyzer;
-    analyzer.setTestSizes(VOLUMES_TESTE);
+    analyzer.setTestSizes(volumes);
+    analyzer.setOutput(arquivoSaida, opcoesSaida);
+    analyzer.setSortMode(modoOrdenacao);
+    analyzer.setCompressedOutput(saidaComprimida);
+    if (usarContadores)
+    {
+        if (despachoEstatico)
+        {
+            std::cout << "⚠️  Contadores de hardware só são coletados no despacho virtual; ignorando --contadores\n\n";
+            usarContadores = false;
+        }
+        else if (!analyzer.setHardwareCounters(true))
+        {
+            std::cout << "⚠️  Contadores de hardware indisponíveis (perf_event_paranoid, máquina virtual sem PMU"
+                      << " ou sistema sem perf_event_open); seguindo só com tempos\n\n";
+            usarContadores = false;
+        }
+    }
 
     auto structureFactories = analyzer.createStructureFactories();
 
-    for (size_t currentVolume : VOLUMES_TESTE)
+    for (size_t currentVolume : volumes)
     {
-        if (currentVolume > allRatings.size())
+        if (currentVolume > totalRatings)
         {
-            std::cout << "Pulando volume de " << currentVolume << " elementos, pois é maior que os dados disponíveis (" << allRatings.size() << ").\n";
+            std::cout << "Pulando volume de " << currentVolume << " elementos, pois é maior que os dados disponíveis (" << totalRatings << ").\n";
             continue;
         }
 
-        std::cout << "⏳ Testando com " << currentVolume << " elementos (" << NUM_REPETICOES << " repetições):\n";
+        std::cout << "⏳ Testando com " << currentVolume << " elementos:\n";
+        maiorVolumeTestado = currentVolume;
+
+        std::vector<int> amostra = RecordSampler::sample(allRatings, totalRatings, currentVolume,
+                                                         modoAmostragem, SEMENTE_AMOSTRAGEM);
+
+        if (despachoEstatico)
+        {
+            // Cada combinação reaproveita estrutura e buffers entre as repetições:
+            // a primeira é a fria e as quentes alimentam as estatísticas até convergirem
+            std::vector<std::string> ordem;
+            std::map<std::string, double> tempoFrioMs;
+            std::map<std::string, BenchmarkStatistics> estatisticas;
+            std::map<std::string, bool> falhou;
+            StaticBenchmark::runAll(amostra, [&](const StaticBenchmark::Result &res)
+                                    {
+                const std::string &structureName = res.structureType;
+                double tempoMs = res.totalTime.count() / 1000000.0;
+                if (estatisticas.count(structureName) == 0)
+                {
+                    ordem.push_back(structureName);
+                    resultadosMemoriaMedida[structureName][currentVolume] = res.memoryUsage;
+                    tempoFrioMs[structureName] = tempoMs;
+                    estatisticas.emplace(structureName, BenchmarkStatistics(configEstatistica));
+                }
+                else if (res.success)
+                {
+                    estatisticas.at(structureName).add(tempoMs);
+                }
+                falhou[structureName] = falhou[structureName] || !res.success;
+                return !falhou[structureName] && !estatisticas.at(structureName).done(); });
+
+            for (const std::string &structureName : ordem)
+            {
+                if (falhou[structureName])
+                {
+                    std::cerr << "❌ Erro ou falha na ordenação para "
+                              << structureName << " com " << currentVolume << " elementos!\n";
+                    resultadosTempoMedio[structureName][currentVolume] = -1.0;
+                    resultadosTempoFrio[structureName][currentVolume] = -1.0;
+                    resultadosMemoriaMedida[structureName][currentVolume] = 0;
+                    continue;
+                }
+                BenchmarkStatistics::Summary resumo = estatisticas.at(structureName).summarize();
+                resultadosTempoMedio[structureName][currentVolume] = resumo.median;
+                resultadosTempoFrio[structureName][currentVolume] = tempoFrioMs[structureName];
+                resultadosEstatisticas[structureName][currentVolume] = resumo;
+                std::cout << "   " << structureName << "... ✅ Concluído! ";
+                exibirResumo(resumo, tempoFrioMs[structureName]);
+                std::cout << "\n";
+            }
+            std::cout << std::endl;
+            continue;
+        }
 
         for (const auto &factoryInfo : structureFactories)
         {
-            double somaTemposMs = 0.0;
+            bool falhou = false;
+            double tempoFrioMs = -1.0;
+            BenchmarkStatistics estatisticas(configEstatistica);
             int testesBemSucedidos = 0;
             size_t memoriaAmostra = 0;
+            double somaEscritaMs = 0.0;
+            size_t bytesEscritos = 0;
+            double somaCompactacaoMs = 0.0;
+            size_t bytesCompactados = 0;
             std::string structureName = factoryInfo.typeName;
 
             std::cout << "   " << structureName << "... " << std::flush;
 
-            for (int k = 0; k < NUM_REPETICOES; ++k)
-            {
-                std::unique_ptr<DataStructure> currentStructure = factoryInfo.factory();
+            // Estrutura e buffers criados uma vez; as repetições reaproveitam a
+            // memória (clear()) e só a primeira paga o primeiro toque nas páginas
+            // A construção entra na conta (ex.: bloco inicial da std::deque, diretório de segmentos)
+            AllocationTracker::Phase construcao;
+            std::unique_ptr<DataStructure> currentStructure = factoryInfo.factory();
+            AllocationTracker::PhaseStats memoriaConstrucao = construcao.finish();
+            BenchmarkContext contexto(currentVolume);
 
+            // Fria, aquecimento e então amostras até o IC alvo (ou MAX_REPETICOES)
+            do
+            {
                 PerformanceAnalyzer::PerformanceResult res =
-                    analyzer.runPerformanceTest(allRatings, currentStructure, currentVolume);
+                    analyzer.runPerformanceTest(amostra, currentStructure, currentVolume, contexto);
 
-                if (res.success)
+                if (!res.success)
                 {
-                    somaTemposMs += res.totalTime.count() / 1000000.0;
-                    testesBemSucedidos++;
-                    if (k == 0)
+                    std::cerr << "❌ Erro ou falha na ordenação em uma das repetições para "
+                              << structureName << " com " << currentVolume << " elementos!\n";
+                    falhou = true;
+                    break;
+                }
+
+                double tempoMs = res.totalTime.count() / 1000000.0;
+                if (res.warm)
+                {
+                    estatisticas.add(tempoMs);
+                    if (usarContadores)
                     {
-                        memoriaAmostra = res.memoryUsage;
+                        resultadosContadores[structureName][currentVolume] =
+                            {{res.loadCounters, res.convertCounters, res.sortCounters, res.convertBackCounters}};
                     }
                 }
                 else
                 {
-                    std::cerr << "❌ Erro ou falha na ordenação em uma das repetições para "
-                              << structureName << " com " << currentVolume << " elementos!\n";
-                    somaTemposMs = -1.0;
-                    memoriaAmostra = 0;
-                    break;
+                    tempoFrioMs = tempoMs;
+                    memoriaAmostra = res.memoryUsage + static_cast<size_t>(std::max<int64_t>(memoriaConstrucao.retainedBytes, 0));
                 }
-            }
+                somaEscritaMs += res.outputTime.count() / 1000000.0;
+                bytesEscritos = res.outputBytes;
+                somaCompactacaoMs += res.compressTime.count() / 1000000.0;
+                bytesCompactados = res.compressedBytes;
+                testesBemSucedidos++;
+            } while (!estatisticas.done());
 
-            if (somaTemposMs != -1.0 && testesBemSucedidos > 0)
+            if (!falhou && testesBemSucedidos > 0)
             {
-                resultadosTempoMedio[structureName][currentVolume] = somaTemposMs / testesBemSucedidos;
-                resultadosMemoriaEstimada[structureName][currentVolume] = memoriaAmostra;
-                std::cout << "✅ Concluído! Média: ("
-                          << std::fixed << std::setprecision(2) << resultadosTempoMedio[structureName][currentVolume] << " ms)\n";
+                BenchmarkStatistics::Summary resumo = estatisticas.summarize();
+                resultadosTempoMedio[structureName][currentVolume] = resumo.median;
+                resultadosTempoFrio[structureName][currentVolume] = tempoFrioMs;
+                resultadosEstatisticas[structureName][currentVolume] = resumo;
+                resultadosMemoriaMedida[structureName][currentVolume] = memoriaAmostra;
+                std::cout << "✅ Concluído! ";
+                exibirResumo(resumo, tempoFrioMs);
+                if (bytesEscritos > 0 && somaEscritaMs > 0.0)
+                {
+                    double mediaEscritaMs = somaEscritaMs / testesBemSucedidos;
+                    std::cout << " Escrita: " << mediaEscritaMs << " ms ("
+                              << (bytesEscritos / (1024.0 * 1024.0)) / (mediaEscritaMs / 1000.0) << " MB/s)";
+                }
+                if (saidaComprimida && currentVolume > 0)
+                {
+                    std::cout << " Compactado: " << bytesCompactados / 1024.0 << " KB ("
+                              << (bytesCompactados * 8.0) / currentVolume << " bits/valor, "
+                              << somaCompactacaoMs / testesBemSucedidos << " ms)";
+                }
+                std::cout << "\n";
             }
             else
             {
                 resultadosTempoMedio[structureName][currentVolume] = -1.0;
-                resultadosMemoriaEstimada[structureName][currentVolume] = 0;
-                if (somaTemposMs != -1.0)
+                resultadosTempoFrio[structureName][currentVolume] = -1.0;
+                resultadosMemoriaMedida[structureName][currentVolume] = 0;
+                if (!falhou)
                 {
                     std::cerr << "❌ Nenhuma repetição bem-sucedida para "
                               << structureName << " com " << currentVolume << " elementos.\n";
@@ -194,7 +772,12 @@ int main()
         std::cout << std::endl;
     }
 
-    exibirTabelaResumoFinal(resultadosTempoMedio, resultadosMemoriaEstimada);
+    exibirTabelaResumoFinal(volumes, resultadosTempoMedio, resultadosTempoFrio, resultadosMemoriaMedida);
+    exibirTabelaEstatisticas(volumes, motor, resultadosEstatisticas);
+    if (usarContadores)
+    {
+        exibirTabelaContadores(maiorVolumeTestado, resultadosContadores);
+    }
 
     return 0;
 }
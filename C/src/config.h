@@ -1,6 +1,8 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <stdint.h>
+
 typedef enum
 {
     LISTA_LINEAR = 1,
@@ -38,7 +40,7 @@ typedef enum
 // Escolha do método de ordenação
 #define METODO_ORDENACAO RADIX_SORT
 
-// Tamanho da entrada para leitura
-#define maxlinhas 1000000
+// Tamanho da entrada para leitura (64 bits; <= 0 lê o arquivo inteiro)
+#define maxlinhas INT64_C(1000000)
 
 #endif
\ No newline at end of file
@@ -21,7 +21,7 @@ int *listToArray(LinkedList *list)
 
     // Como a lista insere no início, os elementos estão em ordem reversa
     // Precisamos colocar no array na ordem correta (primeiro inserido = primeiro no array)
-    for (int i = list->size - 1; i >= 0; i--)
+    for (size_t i = list->size; i-- > 0;)
     {
         array[i] = current->data;
         current = current->next;
@@ -30,7 +30,7 @@ int *listToArray(LinkedList *list)
     return array;
 }
 
-LinkedList *arrayToList(int *array, int size)
+LinkedList *arrayToList(int *array, size_t size)
 {
     LinkedList *list = createList();
     if (!list)
@@ -38,7 +38,7 @@ LinkedList *arrayToList(int *array, int size)
 
     // Inserir em ordem reversa para que o primeiro elemento do array
     // seja o primeiro da lista (já que insertList insere no início)
-    for (int i = size - 1; i >= 0; i--)
+    for (size_t i = size; i-- > 0;)
     {
         insertList(list, array[i]);
     }
@@ -52,13 +52,13 @@ int *stackToArray(Stack *stack)
     if (stack->top < 0)
         return NULL;
 
-    int size = stack->top + 1;
+    size_t size = (size_t)stack->top + 1;
     int *array = (int *)malloc(size * sizeof(int));
     if (!array)
         return NULL;
 
     // Copiar dados da pilha mantendo a ordem de inserção
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         array[i] = stack->data[i];
     }
@@ -66,16 +66,15 @@ int *stackToArray(Stack *stack)
     return array;
 }
 
-Stack *arrayToStack(int *array, int size)
+Stack *arrayToStack(int *array, size_t size)
 {
     Stack *stack = createStack(size);
     if (!stack)
         return NULL;
 
-    for (int i = 0; i < size; i++)
-    {
-        push(stack, array[i]);
-    }
+    // Pilha é baseada em array: cópia em bloco
+    memcpy(stack->data, array, size * sizeof(int));
+    stack->top = (int64_t)size - 1;
 
     return stack;
 }
@@ -90,10 +89,10 @@ int *queueToArray(Queue *queue)
     if (!array)
         return NULL;
 
-    int index = queue->front;
+    size_t index = queue->front;
 
     // Percorrer a fila circular
-    for (int i = 0; i < queue->size; i++)
+    for (size_t i = 0; i < queue->size; i++)
     {
         array[i] = queue->data[index];
         index = (index + 1) % queue->capacity;
@@ -102,16 +101,17 @@ int *queueToArray(Queue *queue)
     return array;
 }
 
-Queue *arrayToQueue(int *array, int size)
+Queue *arrayToQueue(int *array, size_t size)
 {
     Queue *queue = createQueue(size);
     if (!queue)
         return NULL;
 
-    for (int i = 0; i < size; i++)
-    {
-        enqueue(queue, array[i]);
-    }
+    // Fila recém-criada começa em 0: cópia em bloco
+    memcpy(queue->data, array, size * sizeof(int));
+    queue->front = 0;
+    queue->rear = size - 1;
+    queue->size = size;
 
     return queue;
 }
@@ -134,7 +134,7 @@ int *linearListToArray(LinearList *list)
     return array;
 }
 
-LinearList *arrayToLinearList(int *array, int size)
+LinearList *arrayToLinearList(int *array, size_t size)
 {
     LinearList *list = createLinearList(size);
     if (!list)
@@ -153,7 +153,7 @@ int *linearStackToArray(LinearStack *stack)
     if (stack->top < 0)
         return NULL;
 
-    int size = stack->top + 1;
+    size_t size = (size_t)stack->top + 1;
     int *array = (int *)malloc(size * sizeof(int));
     if (!array)
         return NULL;
@@ -164,7 +164,7 @@ int *linearStackToArray(LinearStack *stack)
     return array;
 }
 
-LinearStack *arrayToLinearStack(int *array, int size)
+LinearStack *arrayToLinearStack(int *array, size_t size)
 {
     LinearStack *stack = createLinearStack(size);
     if (!stack)
@@ -172,7 +172,7 @@ LinearStack *arrayToLinearStack(int *array, int size)
 
     // Copiar todos os elementos de uma vez
     memcpy(stack->data, array, size * sizeof(int));
-    stack->top = size - 1;
+    stack->top = (int64_t)size - 1;
 
     return stack;
 }
@@ -187,10 +187,10 @@ int *linearQueueToArray(LinearQueue *queue)
     if (!array)
         return NULL;
 
-    int index = queue->front;
+    size_t index = queue->front;
 
     // Percorrer a fila circular
-    for (int i = 0; i < queue->size; i++)
+    for (size_t i = 0; i < queue->size; i++)
     {
         array[i] = queue->data[index];
         index = (index + 1) % queue->capacity;
@@ -199,7 +199,7 @@ int *linearQueueToArray(LinearQueue *queue)
     return array;
 }
 
-LinearQueue *arrayToLinearQueue(int *array, int size)
+LinearQueue *arrayToLinearQueue(int *array, size_t size)
 {
     LinearQueue *queue = createLinearQueue(size);
     if (!queue)
@@ -217,9 +217,9 @@ LinearQueue *arrayToLinearQueue(int *array, int size)
 
 // ========== FUNÇÕES AUXILIARES ==========
 
-int *copyArray(int *source, int size)
+int *copyArray(int *source, size_t size)
 {
-    if (!source || size <= 0)
+    if (!source || size == 0)
         return NULL;
 
     int *copy = (int *)malloc(size * sizeof(int));
@@ -230,28 +230,28 @@ int *copyArray(int *source, int size)
     return copy;
 }
 
-int getStackSize(Stack *stack)
+size_t getStackSize(Stack *stack)
 {
     if (!stack)
         return 0;
-    return stack->top + 1;
+    return (size_t)(stack->top + 1);
 }
 
-int getLinearStackSize(LinearStack *stack)
+size_t getLinearStackSize(LinearStack *stack)
 {
     if (!stack)
         return 0;
-    return stack->top + 1;
+    return (size_t)(stack->top + 1);
 }
 
 // Funções adicionais para verificação de integridade
-int verifyArrayIntegrity(int *array, int size)
+int verifyArrayIntegrity(int *array, size_t size)
 {
-    if (!array || size <= 0)
+    if (!array || size == 0)
         return 0;
 
     // Verificar se todos os elementos são válidos (não negativos para ratings)
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         if (array[i] < 0)
             return 0;
@@ -259,14 +259,14 @@ int verifyArrayIntegrity(int *array, int size)
     return 1;
 }
 
-void printArraySample(int *array, int size, const char *label)
+void printArraySample(int *array, size_t size, const char *label)
 {
-    if (!array || size <= 0)
+    if (!array || size == 0)
         return;
 
     printf("%s (primeiros 10): ", label);
-    int limit = (size < 10) ? size : 10;
-    for (int i = 0; i < limit; i++)
+    size_t limit = (size < 10) ? size : 10;
+    for (size_t i = 0; i < limit; i++)
     {
         printf("%d ", array[i]);
     }
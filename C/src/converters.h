@@ -7,37 +7,37 @@
 
 // Conversões Lista Ligada
 int *listToArray(LinkedList *list);
-LinkedList *arrayToList(int *array, int size);
+LinkedList *arrayToList(int *array, size_t size);
 
 // Conversões Pilha
 int *stackToArray(Stack *stack);
-Stack *arrayToStack(int *array, int size);
+Stack *arrayToStack(int *array, size_t size);
 
 // Conversões Fila
 int *queueToArray(Queue *queue);
-Queue *arrayToQueue(int *array, int size);
+Queue *arrayToQueue(int *array, size_t size);
 
 // ========== CONVERSÕES - ESTRUTURAS LINEARES ==========
 
 // Conversões Lista Linear
 int *linearListToArray(LinearList *list);
-LinearList *arrayToLinearList(int *array, int size);
+LinearList *arrayToLinearList(int *array, size_t size);
 
 // Conversões Pilha Linear
 int *linearStackToArray(LinearStack *stack);
-LinearStack *arrayToLinearStack(int *array, int size);
+LinearStack *arrayToLinearStack(int *array, size_t size);
 
 // Conversões Fila Linear
 int *linearQueueToArray(LinearQueue *queue);
-LinearQueue *arrayToLinearQueue(int *array, int size);
+LinearQueue *arrayToLinearQueue(int *array, size_t size);
 
 // ========== FUNÇÕES AUXILIARES ==========
 
 // Função para copiar array
-int *copyArray(int *source, int size);
+int *copyArray(int *source, size_t size);
 
 // Função para obter tamanho das estruturas
-int getStackSize(Stack *stack);
-int getLinearStackSize(LinearStack *stack);
+size_t getStackSize(Stack *stack);
+size_t getLinearStackSize(LinearStack *stack);
 
 #endif
\ No newline at end of file
@@ -2,13 +2,13 @@
 #include <string.h>
 #include "counting_sort.h"
 
-int findMax(int *array, int size)
+int findMax(int *array, size_t size)
 {
-    if (size <= 0)
+    if (size == 0)
         return 0;
 
     int max = array[0];
-    for (int i = 1; i < size; i++)
+    for (size_t i = 1; i < size; i++)
     {
         if (array[i] > max)
         {
@@ -18,9 +18,9 @@ int findMax(int *array, int size)
     return max;
 }
 
-int isArraySorted(int *array, int size)
+int isArraySorted(int *array, size_t size)
 {
-    for (int i = 1; i < size; i++)
+    for (size_t i = 1; i < size; i++)
     {
         if (array[i] < array[i - 1])
         {
@@ -30,7 +30,7 @@ int isArraySorted(int *array, int size)
     return 1; // Está ordenado
 }
 
-void countingSort(int *array, int size)
+void countingSort(int *array, size_t size)
 {
     if (size <= 1)
         return;
@@ -38,17 +38,19 @@ void countingSort(int *array, int size)
     // Encontrar o valor máximo
     int max = findMax(array, size);
 
-    // Criar array de contagem
-    int *count = (int *)calloc(max + 1, sizeof(int));
+    // Criar array de contagem (64 bits: uma chave pode repetir mais de 2^31 vezes)
+    size_t *count = (size_t *)calloc((size_t)max + 1, sizeof(size_t));
+    if (!count)
+        return;
 
     // Contar occorrências
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         count[array[i]]++;
     }
 
     // Reconstruir array ordenado
-    int index = 0;
+    size_t index = 0;
     for (int i = 0; i <= max; i++)
     {
         while (count[i] > 0)
@@ -61,7 +63,7 @@ void countingSort(int *array, int size)
     free(count);
 }
 
-void countingSortStable(int *array, int size)
+void countingSortStable(int *array, size_t size)
 {
     if (size <= 1)
         return;
@@ -70,11 +72,17 @@ void countingSortStable(int *array, int size)
     int max = findMax(array, size);
 
     // Criar arrays auxiliares
-    int *count = (int *)calloc(max + 1, sizeof(int));
+    size_t *count = (size_t *)calloc((size_t)max + 1, sizeof(size_t));
     int *output = (int *)malloc(size * sizeof(int));
+    if (!count || !output)
+    {
+        free(count);
+        free(output);
+        return;
+    }
 
     // Contar occorrências
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         count[array[i]]++;
     }
@@ -86,14 +94,14 @@ void countingSortStable(int *array, int size)
     }
 
     // Construir array de saída (de trás para frente para manter estabilidade)
-    for (int i = size - 1; i >= 0; i--)
+    for (size_t i = size; i-- > 0;)
     {
         output[count[array[i]] - 1] = array[i];
         count[array[i]]--;
     }
 
     // Copiar de volta para o array original
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         array[i] = output[i];
     }
@@ -1,16 +1,18 @@
 #ifndef COUNTING_SORT_H
 #define COUNTING_SORT_H
 
+#include <stddef.h>
+
 // Algoritmo básico Counting Sort
-void countingSort(int *array, int size);
+void countingSort(int *array, size_t size);
 
 // Versão estável do Counting Sort
-void countingSortStable(int *array, int size);
+void countingSortStable(int *array, size_t size);
 
 // Função para encontrar valor máximo
-int findMax(int *array, int size);
+int findMax(int *array, size_t size);
 
 // Função para verificar se array está ordenado
-int isArraySorted(int *array, int size);
+int isArraySorted(int *array, size_t size);
 
 #endif
\ No newline at end of file
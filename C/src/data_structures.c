@@ -46,9 +46,9 @@ void destroyList(LinkedList *list)
 }
 
 // === IMPLEMENTAÇÕES DA PILHA ===
-Stack *createStack(int capacity)
+Stack *createStack(size_t capacity)
 {
-    if (capacity <= 0)
+    if (capacity == 0)
         return NULL;
 
     Stack *stack = (Stack *)malloc(sizeof(Stack));
@@ -69,7 +69,7 @@ Stack *createStack(int capacity)
 
 void push(Stack *stack, int value)
 {
-    if (!stack || stack->top >= stack->capacity - 1)
+    if (!stack || stack->top >= (int64_t)stack->capacity - 1)
         return;
 
     stack->data[++stack->top] = value;
@@ -98,9 +98,9 @@ void destroyStack(Stack *stack)
 }
 
 // === IMPLEMENTAÇÕES DA FILA ===
-Queue *createQueue(int capacity)
+Queue *createQueue(size_t capacity)
 {
-    if (capacity <= 0)
+    if (capacity == 0)
         return NULL;
 
     Queue *queue = (Queue *)malloc(sizeof(Queue));
@@ -115,7 +115,7 @@ Queue *createQueue(int capacity)
     }
 
     queue->front = 0;
-    queue->rear = -1;
+    queue->rear = capacity - 1; // O primeiro enqueue avança para 0
     queue->size = 0;
     queue->capacity = capacity;
     return queue;
@@ -133,7 +133,7 @@ void enqueue(Queue *queue, int value)
 
 int dequeue(Queue *queue)
 {
-    if (!queue || queue->size <= 0)
+    if (!queue || queue->size == 0)
         return -1;
 
     int value = queue->data[queue->front];
@@ -144,7 +144,7 @@ int dequeue(Queue *queue)
 
 int isQueueEmpty(Queue *queue)
 {
-    return (!queue || queue->size <= 0);
+    return (!queue || queue->size == 0);
 }
 
 void destroyQueue(Queue *queue)
@@ -159,9 +159,9 @@ void destroyQueue(Queue *queue)
 // ========== IMPLEMENTAÇÕES - ESTRUTURAS LINEARES ==========
 
 // === LISTA LINEAR ===
-LinearList *createLinearList(int capacity)
+LinearList *createLinearList(size_t capacity)
 {
-    if (capacity <= 0)
+    if (capacity == 0)
         return NULL;
 
     LinearList *list = (LinearList *)malloc(sizeof(LinearList));
@@ -186,7 +186,7 @@ void insertLinearList(LinearList *list, int value)
         return;
 
     // Inserir no início (mover todos os elementos para a direita)
-    for (int i = list->size; i > 0; i--)
+    for (size_t i = list->size; i > 0; i--)
     {
         list->data[i] = list->data[i - 1];
     }
@@ -202,9 +202,9 @@ void appendLinearList(LinearList *list, int value)
     list->data[list->size++] = value;
 }
 
-int getLinearList(LinearList *list, int index)
+int getLinearList(LinearList *list, size_t index)
 {
-    if (!list || index < 0 || index >= list->size)
+    if (!list || index >= list->size)
         return -1;
 
     return list->data[index];
@@ -220,9 +220,9 @@ void destroyLinearList(LinearList *list)
 }
 
 // === PILHA LINEAR ===
-LinearStack *createLinearStack(int capacity)
+LinearStack *createLinearStack(size_t capacity)
 {
-    if (capacity <= 0)
+    if (capacity == 0)
         return NULL;
 
     LinearStack *stack = (LinearStack *)malloc(sizeof(LinearStack));
@@ -243,7 +243,7 @@ LinearStack *createLinearStack(int capacity)
 
 void pushLinear(LinearStack *stack, int value)
 {
-    if (!stack || stack->top >= stack->capacity - 1)
+    if (!stack || stack->top >= (int64_t)stack->capacity - 1)
         return;
 
     stack->data[++stack->top] = value;
@@ -272,9 +272,9 @@ void destroyLinearStack(LinearStack *stack)
 }
 
 // === FILA LINEAR ===
-LinearQueue *createLinearQueue(int capacity)
+LinearQueue *createLinearQueue(size_t capacity)
 {
-    if (capacity <= 0)
+    if (capacity == 0)
         return NULL;
 
     LinearQueue *queue = (LinearQueue *)malloc(sizeof(LinearQueue));
@@ -289,7 +289,7 @@ LinearQueue *createLinearQueue(int capacity)
     }
 
     queue->front = 0;
-    queue->rear = -1;
+    queue->rear = capacity - 1; // O primeiro enqueue avança para 0
     queue->size = 0;
     queue->capacity = capacity;
     return queue;
@@ -307,7 +307,7 @@ void enqueueLinear(LinearQueue *queue, int value)
 
 int dequeueLinear(LinearQueue *queue)
 {
-    if (!queue || queue->size <= 0)
+    if (!queue || queue->size == 0)
         return -1;
 
     int value = queue->data[queue->front];
@@ -318,7 +318,7 @@ int dequeueLinear(LinearQueue *queue)
 
 int isLinearQueueEmpty(LinearQueue *queue)
 {
-    return (!queue || queue->size <= 0);
+    return (!queue || queue->size == 0);
 }
 
 void destroyLinearQueue(LinearQueue *queue)
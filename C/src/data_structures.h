@@ -1,5 +1,8 @@
 #ifndef DATA_STRUCTURES_H
 #define DATA_STRUCTURES_H
+
+#include <stddef.h>
+#include <stdint.h>
 // ESTRUTURAS DE DADOS DINAMICAS
 //  Estrutura para Lista
 typedef struct Node
@@ -11,25 +14,25 @@ typedef struct Node
 typedef struct
 {
     Node *head;
-    int size;
+    size_t size;
 } LinkedList;
 
 // Estrutura para Pilha
 typedef struct
 {
     int *data;
-    int top;
-    int capacity;
+    int64_t top; // -1 quando vazia
+    size_t capacity;
 } Stack;
 
 // Estrutura para Fila
 typedef struct
 {
     int *data;
-    int front;
-    int rear;
-    int size;
-    int capacity;
+    size_t front;
+    size_t rear;
+    size_t size;
+    size_t capacity;
 } Queue;
 
 // Lista
@@ -38,13 +41,13 @@ void insertList(LinkedList *list, int value);
 void destroyList(LinkedList *list);
 
 // Pilha
-Stack *createStack(int capacity);
+Stack *createStack(size_t capacity);
 void push(Stack *stack, int value);
 int pop(Stack *stack);
 void destroyStack(Stack *stack);
 
 // Fila
-Queue *createQueue(int capacity);
+Queue *createQueue(size_t capacity);
 void enqueue(Queue *queue, int value);
 int dequeue(Queue *queue);
 void destroyQueue(Queue *queue);
@@ -55,40 +58,40 @@ void destroyQueue(Queue *queue);
 typedef struct
 {
     int *data;
-    int size;
-    int capacity;
+    size_t size;
+    size_t capacity;
 } LinearList;
 
 // Pilha Linear
 typedef struct
 {
     int *data;
-    int top;
-    int capacity;
+    int64_t top; // -1 quando vazia
+    size_t capacity;
 } LinearStack;
 
 // Fila Linear
 typedef struct
 {
     int *data;
-    int front;
-    int rear;
-    int size;
-    int capacity;
+    size_t front;
+    size_t rear;
+    size_t size;
+    size_t capacity;
 } LinearQueue;
 
 // Lista Linear
-LinearList *createLinearList(int capacity);
+LinearList *createLinearList(size_t capacity);
 void appendLinearList(LinearList *list, int value);
 void destroyLinearList(LinearList *list);
 // Pilha Linear
-LinearStack *createLinearStack(int capacity);
+LinearStack *createLinearStack(size_t capacity);
 void pushLinear(LinearStack *stack, int value);
 int popLinear(LinearStack *stack);
 int isLinearStackEmpty(LinearStack *stack);
 void destroyLinearStack(LinearStack *stack);
 // Fila Linear
-LinearQueue *createLinearQueue(int capacity);
+LinearQueue *createLinearQueue(size_t capacity);
 void enqueueLinear(LinearQueue *queue, int value);
 int dequeueLinear(LinearQueue *queue);
 void destroyLinearQueue(LinearQueue *queue);
@@ -0,0 +1,363 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "input_stream.h"
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+typedef enum
+{
+    ENTRADA_TEXTO = 0,
+    ENTRADA_GZIP = 1,
+    ENTRADA_ZSTD = 2
+} FormatoEntrada;
+
+struct InputStream
+{
+    FormatoEntrada formato;
+    FILE *file;
+#ifdef USE_ZLIB
+    gzFile gz;
+#endif
+#ifdef USE_ZSTD
+    ZSTD_DStream *zstd;
+    char *zstdIn;
+    ZSTD_inBuffer zstdInBuffer;
+    int zstdEof;
+    int zstdFrameOpen; // Último ZSTD_decompressStream não terminou o frame
+#endif
+
+    // Anel de blocos reutilizáveis, consumidos na ordem em que são preenchidos
+    char *blocks[INPUT_NUM_BLOCKS];
+    size_t blockSizes[INPUT_NUM_BLOCKS];
+    int writeIndex;
+    int readIndex;
+    int filledCount;
+
+    // Estado do consumidor
+    int hasCurrent;
+    size_t position;
+
+    int started;
+    int finished;
+    int stop;
+    int error;
+
+    pthread_t producer;
+    pthread_mutex_t mutex;
+    pthread_cond_t blockFilled;
+    pthread_cond_t blockFreed;
+};
+
+// ========== LEITURA DA FONTE ==========
+
+static int endsWith(const char *str, const char *suffix)
+{
+    size_t lenStr = strlen(str);
+    size_t lenSuffix = strlen(suffix);
+    return lenStr >= lenSuffix && strcmp(str + lenStr - lenSuffix, suffix) == 0;
+}
+
+// Retorna bytes lidos, 0 no fim e -1 em erro (inclusive arquivo truncado)
+static long readSource(InputStream *stream, char *buffer, size_t capacity)
+{
+    switch (stream->formato)
+    {
+#ifdef USE_ZLIB
+    case ENTRADA_GZIP:
+    {
+        int bytes = gzread(stream->gz, buffer, (unsigned)capacity);
+        // Fluxo truncado: gzread devolve o que conseguiu e marca Z_BUF_ERROR
+        int errnum = Z_OK;
+        gzerror(stream->gz, &errnum);
+        if (bytes < 0 || (errnum != Z_OK && errnum != Z_STREAM_END))
+            return -1;
+        return bytes;
+    }
+#endif
+#ifdef USE_ZSTD
+    case ENTRADA_ZSTD:
+    {
+        ZSTD_outBuffer out = {buffer, capacity, 0};
+        while (out.pos < out.size)
+        {
+            if (stream->zstdInBuffer.pos == stream->zstdInBuffer.size)
+            {
+                if (stream->zstdEof)
+                    break;
+                stream->zstdInBuffer.size = fread(stream->zstdIn, 1, ZSTD_DStreamInSize(), stream->file);
+                stream->zstdInBuffer.pos = 0;
+                if (ferror(stream->file))
+                    return -1;
+                if (stream->zstdInBuffer.size == 0)
+                {
+                    if (stream->zstdFrameOpen)
+                        return -1;
+                    stream->zstdEof = 1;
+                    break;
+                }
+            }
+            size_t ret = ZSTD_decompressStream(stream->zstd, &out, &stream->zstdInBuffer);
+            if (ZSTD_isError(ret))
+                return -1;
+            stream->zstdFrameOpen = ret != 0;
+        }
+        return (long)out.pos;
+    }
+#endif
+    default:
+    {
+        size_t bytes = fread(buffer, 1, capacity, stream->file);
+        if (bytes < capacity && ferror(stream->file))
+            return -1;
+        return (long)bytes;
+    }
+    }
+}
+
+static void *producerThread(void *arg)
+{
+    InputStream *stream = (InputStream *)arg;
+
+    while (1)
+    {
+        pthread_mutex_lock(&stream->mutex);
+        while (!stream->stop && stream->filledCount == INPUT_NUM_BLOCKS)
+            pthread_cond_wait(&stream->blockFreed, &stream->mutex);
+        if (stream->stop)
+        {
+            pthread_mutex_unlock(&stream->mutex);
+            break;
+        }
+        int index = stream->writeIndex;
+        pthread_mutex_unlock(&stream->mutex);
+
+        // Preenche o bloco inteiro fora do lock
+        size_t total = 0;
+        int erro = 0;
+        while (total < INPUT_BLOCK_SIZE)
+        {
+            long bytes = readSource(stream, stream->blocks[index] + total, INPUT_BLOCK_SIZE - total);
+            if (bytes < 0)
+            {
+                erro = 1;
+                break;
+            }
+            if (bytes == 0)
+                break;
+            total += (size_t)bytes;
+        }
+
+        pthread_mutex_lock(&stream->mutex);
+        if (total > 0)
+        {
+            stream->blockSizes[index] = total;
+            stream->writeIndex = (index + 1) % INPUT_NUM_BLOCKS;
+            stream->filledCount++;
+        }
+        if (erro)
+            stream->error = 1;
+        if (erro || total < INPUT_BLOCK_SIZE)
+            stream->finished = 1;
+        pthread_cond_signal(&stream->blockFilled);
+        int done = stream->finished;
+        pthread_mutex_unlock(&stream->mutex);
+
+        if (done)
+            return NULL;
+    }
+
+    pthread_mutex_lock(&stream->mutex);
+    stream->finished = 1;
+    pthread_cond_signal(&stream->blockFilled);
+    pthread_mutex_unlock(&stream->mutex);
+    return NULL;
+}
+
+// ========== API PÚBLICA ==========
+
+InputStream *openInputStream(const char *filename)
+{
+    InputStream *stream = (InputStream *)calloc(1, sizeof(InputStream));
+    if (!stream)
+        return NULL;
+
+    if (endsWith(filename, ".gz"))
+    {
+#ifdef USE_ZLIB
+        stream->formato = ENTRADA_GZIP;
+        stream->gz = gzopen(filename, "rb");
+        if (!stream->gz)
+        {
+            free(stream);
+            return NULL;
+        }
+        gzbuffer(stream->gz, 1 << 18);
+#else
+        printf("Suporte a gzip não compilado (make ZLIB=1): %s\n", filename);
+        free(stream);
+        return NULL;
+#endif
+    }
+    else if (endsWith(filename, ".zst"))
+    {
+#ifdef USE_ZSTD
+        stream->formato = ENTRADA_ZSTD;
+        stream->file = fopen(filename, "rb");
+        if (!stream->file)
+        {
+            free(stream);
+            return NULL;
+        }
+        stream->zstd = ZSTD_createDStream();
+        ZSTD_initDStream(stream->zstd);
+        stream->zstdIn = (char *)malloc(ZSTD_DStreamInSize());
+        stream->zstdInBuffer.src = stream->zstdIn;
+#else
+        printf("Suporte a zstd não compilado (make ZSTD=1): %s\n", filename);
+        free(stream);
+        return NULL;
+#endif
+    }
+    else
+    {
+        stream->formato = ENTRADA_TEXTO;
+        stream->file = fopen(filename, "rb");
+        if (!stream->file)
+        {
+            free(stream);
+            return NULL;
+        }
+    }
+
+    for (int i = 0; i < INPUT_NUM_BLOCKS; i++)
+    {
+        stream->blocks[i] = (char *)malloc(INPUT_BLOCK_SIZE);
+        if (!stream->blocks[i])
+        {
+            closeInputStream(stream);
+            return NULL;
+        }
+    }
+
+    pthread_mutex_init(&stream->mutex, NULL);
+    pthread_cond_init(&stream->blockFilled, NULL);
+    pthread_cond_init(&stream->blockFreed, NULL);
+    if (pthread_create(&stream->producer, NULL, producerThread, stream) != 0)
+    {
+        closeInputStream(stream);
+        return NULL;
+    }
+    stream->started = 1;
+
+    return stream;
+}
+
+// Garante um bloco atual com bytes não consumidos; 0 no fim dos dados
+static int acquireBlock(InputStream *stream)
+{
+    if (stream->hasCurrent && stream->position < stream->blockSizes[stream->readIndex])
+        return 1;
+
+    pthread_mutex_lock(&stream->mutex);
+    if (stream->hasCurrent)
+    {
+        // Devolve o bloco consumido ao produtor
+        stream->readIndex = (stream->readIndex + 1) % INPUT_NUM_BLOCKS;
+        stream->filledCount--;
+        stream->hasCurrent = 0;
+        pthread_cond_signal(&stream->blockFreed);
+    }
+    while (stream->filledCount == 0 && !stream->finished)
+        pthread_cond_wait(&stream->blockFilled, &stream->mutex);
+    int available = stream->filledCount > 0;
+    pthread_mutex_unlock(&stream->mutex);
+
+    if (!available)
+        return 0;
+
+    stream->hasCurrent = 1;
+    stream->position = 0;
+    return 1;
+}
+
+char *readLineInputStream(InputStream *stream, char *buffer, int size)
+{
+    if (!stream || size <= 1)
+        return NULL;
+
+    int length = 0;
+    while (length < size - 1)
+    {
+        if (!acquireBlock(stream))
+            break;
+
+        const char *data = stream->blocks[stream->readIndex] + stream->position;
+        size_t available = stream->blockSizes[stream->readIndex] - stream->position;
+        size_t room = (size_t)(size - 1 - length);
+        size_t limit = available < room ? available : room;
+
+        const char *newline = (const char *)memchr(data, '\n', limit);
+        size_t copy = newline ? (size_t)(newline - data) + 1 : limit;
+
+        memcpy(buffer + length, data, copy);
+        length += (int)copy;
+        stream->position += copy;
+
+        if (newline)
+            break;
+    }
+
+    if (length == 0)
+        return NULL;
+
+    buffer[length] = '\0';
+    return buffer;
+}
+
+int hasErrorInputStream(InputStream *stream)
+{
+    return stream ? stream->error : 1;
+}
+
+void closeInputStream(InputStream *stream)
+{
+    if (!stream)
+        return;
+
+    if (stream->started)
+    {
+        pthread_mutex_lock(&stream->mutex);
+        stream->stop = 1;
+        pthread_cond_signal(&stream->blockFreed);
+        pthread_mutex_unlock(&stream->mutex);
+        pthread_join(stream->producer, NULL);
+
+        pthread_mutex_destroy(&stream->mutex);
+        pthread_cond_destroy(&stream->blockFilled);
+        pthread_cond_destroy(&stream->blockFreed);
+    }
+
+    for (int i = 0; i < INPUT_NUM_BLOCKS; i++)
+        free(stream->blocks[i]);
+
+#ifdef USE_ZLIB
+    if (stream->gz)
+        gzclose(stream->gz);
+#endif
+#ifdef USE_ZSTD
+    if (stream->zstd)
+        ZSTD_freeDStream(stream->zstd);
+    free(stream->zstdIn);
+#endif
+    if (stream->file)
+        fclose(stream->file);
+    free(stream);
+}
@@ -0,0 +1,27 @@
+#ifndef INPUT_STREAM_H
+#define INPUT_STREAM_H
+
+#include <stddef.h>
+
+// Leitura de arquivo em blocos com uma thread produtora que lê/descomprime
+// enquanto a thread chamadora faz o parsing.
+// Formatos: texto simples, .gz (compilar com USE_ZLIB) e .zst (USE_ZSTD)
+
+#define INPUT_BLOCK_SIZE (1 << 20)
+#define INPUT_NUM_BLOCKS 3
+
+typedef struct InputStream InputStream;
+
+// Abre o arquivo e inicia a thread produtora; NULL em caso de erro
+InputStream *openInputStream(const char *filename);
+
+// Lê uma linha como fgets (inclui '\n'); NULL no fim dos dados
+char *readLineInputStream(InputStream *stream, char *buffer, int size);
+
+// Retorna 1 se a leitura/descompressão falhou
+int hasErrorInputStream(InputStream *stream);
+
+// Interrompe a thread produtora e libera os blocos
+void closeInputStream(InputStream *stream);
+
+#endif
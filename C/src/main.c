@@ -8,15 +8,16 @@
 #include "converters.h"
 #include "counting_sort.h"
 #include "config.h"
+#include "utils.h"
 
-const int VOLUMES_TESTE[] = {100, 1000, 10000, 100000, 1000000};
+const size_t VOLUMES_TESTE[] = {100, 1000, 10000, 100000, 1000000};
 const int NUM_VOLUMES = sizeof(VOLUMES_TESTE) / sizeof(VOLUMES_TESTE[0]);
 const int NUM_REPETICOES = 10;
 
 typedef struct
 {
     double tempoTotal;
-    int numElementos;
+    size_t numElementos;
     int ordenadoCorretamente;
 } ResultadoMedicao;
 
@@ -50,9 +51,9 @@ size_t getMemoryUsage()
 size_t getMemoryUsage() { return 0; }
 #endif
 
-size_t calculatePreciseMemoryUsage(TipoEstrutura tipo, int numElementos)
+size_t calculatePreciseMemoryUsage(TipoEstrutura tipo, size_t numElementos)
 {
-    if (numElementos <= 0)
+    if (numElementos == 0)
         return 0;
 
     switch (tipo)
@@ -74,16 +75,17 @@ size_t calculatePreciseMemoryUsage(TipoEstrutura tipo, int numElementos)
     }
 }
 
-ResultadoMedicao medirDesempenho(TipoEstrutura tipo_estrutura, int maxLines)
+ResultadoMedicao medirDesempenho(TipoEstrutura tipo_estrutura, CSVData *dados, int64_t maxLines)
 {
     ResultadoMedicao resultado = {0.0, 0, 0};
     void *estrutura = NULL;
     int *array = NULL;
     clock_t inicio_total, fim_total;
 
-    int numElementos = lerDados_PorTipo(&estrutura, tipo_estrutura, TIPO_DADO, maxLines);
-    if (numElementos <= 0)
+    int64_t quantidade = preencherEstrutura(&estrutura, tipo_estrutura, dados, maxLines);
+    if (quantidade <= 0)
         return resultado;
+    size_t numElementos = (size_t)quantidade;
     resultado.numElementos = numElementos;
 
     inicio_total = clock();
@@ -182,7 +184,7 @@ void exibirTabelaResumoFinal(double tempos[6][NUM_VOLUMES], size_t memorias[6][N
     printf("%-22s | %-10s |", "Estrutura", "Tipo");
     for (int i = 0; i < NUM_VOLUMES; i++)
     {
-        printf(" %10d |", VOLUMES_TESTE[i]);
+        printf(" %10zu |", VOLUMES_TESTE[i]);
     }
     printf("\n------------------------------------------------------------------------------------------------------------\n");
 
@@ -227,20 +229,117 @@ void exibirTabelaResumoFinal(double tempos[6][NUM_VOLUMES], size_t memorias[6][N
     printf("============================================================================================================\n");
 }
 
-int main()
+// ========== TESTE DE VOLUME GRANDE (> 2^31 ELEMENTOS) ==========
+
+// Volume padrão: passa de INT_MAX para exercitar índices e contagens de 64 bits
+#define VOLUME_TESTE_GRANDE (((size_t)1 << 31) + ((size_t)1 << 20))
+#define MAIOR_RATING 10
+
+// Preenche com ratings pseudoaleatórios (xorshift) e acumula o histograma
+static void gerarRatingsGrandes(int *array, size_t numElementos, size_t histograma[MAIOR_RATING + 1])
+{
+    uint64_t estado = 0x9E3779B97F4A7C15ULL;
+    memset(histograma, 0, (MAIOR_RATING + 1) * sizeof(size_t));
+    for (size_t i = 0; i < numElementos; i++)
+    {
+        estado ^= estado << 13;
+        estado ^= estado >> 7;
+        estado ^= estado << 17;
+        int valor = (int)(estado % (MAIOR_RATING + 1));
+        array[i] = valor;
+        histograma[valor]++;
+    }
+}
+
+// Ordenado e com a mesma quantidade de cada valor que a entrada
+static int conferirRatingsGrandes(int *array, size_t numElementos, const size_t histograma[MAIOR_RATING + 1])
 {
+    if (!isArraySorted(array, numElementos))
+        return 0;
+
+    size_t inicio = 0;
+    for (int valor = 0; valor <= MAIOR_RATING; valor++)
+    {
+        size_t fim = inicio + histograma[valor];
+        if (histograma[valor] > 0 && (array[inicio] != valor || array[fim - 1] != valor))
+            return 0;
+        inicio = fim;
+    }
+    return inicio == numElementos;
+}
+
+int executarTesteGrande(size_t numElementos)
+{
+    printf("🧪 Teste de volume grande: %zu elementos (%.2f GB)\n",
+           numElementos, numElementos * sizeof(int) / (1024.0 * 1024.0 * 1024.0));
+
+    int *array = (int *)malloc(numElementos * sizeof(int));
+    if (!array)
+    {
+        printf("❌ Memória insuficiente para %zu elementos.\n", numElementos);
+        return 1;
+    }
+
+    size_t histograma[MAIOR_RATING + 1];
+    MetodoOrdenacao metodos[] = {COUNTING_SORT, RADIX_SORT};
+    const char *nomesMetodos[] = {"Counting Sort", "Radix Sort"};
+    int falhas = 0;
+
+    for (int m = 0; m < 2; m++)
+    {
+        gerarRatingsGrandes(array, numElementos, histograma);
+
+        clock_t inicio = clock();
+        if (metodos[m] == COUNTING_SORT)
+            countingSort(array, numElementos);
+        else
+            radixSort(array, numElementos);
+        clock_t fim = clock();
+
+        int correto = conferirRatingsGrandes(array, numElementos, histograma);
+        printf("%s %-14s %10.2f ms\n", correto ? "✅" : "❌", nomesMetodos[m],
+               ((double)(fim - inicio)) / CLOCKS_PER_SEC * 1000);
+        if (!correto)
+            falhas++;
+    }
+
+    free(array);
+    return falhas > 0;
+}
+
+int main(int argc, char *argv[])
+{
+    // --teste-grande [elementos]: ordena um único array acima de 2^31 e sai
+    if (argc > 1 && strcmp(argv[1], "--teste-grande") == 0)
+    {
+        size_t numElementos = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : VOLUME_TESTE_GRANDE;
+        return executarTesteGrande(numElementos > 0 ? numElementos : VOLUME_TESTE_GRANDE);
+    }
+
+    // Caminho do arquivo pode ser passado na linha de comando
+    const char *arquivoEntrada = (argc > 1) ? argv[1] : ARQUIVO_ENTRADA;
+
     printf("\n");
     printf("╔═══════════════════════════════════════════════════════════════════════════════════════╗\n");
     printf("║                 ANÁLISE DE DESEMPENHO - ESTRUTURAS DE DADOS (LINGUAGEM C)                 ║\n");
     printf("║                                     COUNTING SORT                                     ║\n");
     printf("╚═══════════════════════════════════════════════════════════════════════════════════════╝\n");
-    printf("📁 Arquivo: %s\n", ARQUIVO_ENTRADA);
+    printf("📁 Arquivo: %s\n", arquivoEntrada);
     printf("📊 Volumes de teste: ");
     for (int i = 0; i < NUM_VOLUMES; i++)
-        printf("%d ", VOLUMES_TESTE[i]);
+        printf("%zu ", VOLUMES_TESTE[i]);
     printf("\n");
     printf("🔄 Repetições por teste: %d\n\n", NUM_REPETICOES);
 
+    // Leitura única do arquivo; cada repetição preenche a estrutura a partir da memória
+    CSVData *dados = lerDados_CSV(arquivoEntrada, maxlinhas, TIPO_DADO);
+    if (!dados || dados->count == 0)
+    {
+        printf("Nenhum dado foi lido do arquivo. Saindo.\n");
+        destroyCSVData(dados);
+        return 1;
+    }
+
     TipoEstrutura estruturas[] = {LISTA_LINEAR, LISTA_DINAMICA, PILHA_LINEAR, PILHA_DINAMICA, FILA_LINEAR, FILA_DINAMICA};
     const int NUM_ESTRUTURAS = sizeof(estruturas) / sizeof(estruturas[0]);
     const char *nomesEstruturas[] = {"Lista Linear", "Lista Dinamica", "Pilha Linear", "Pilha Dinamica", "Fila Linear", "Fila Dinamica"};
@@ -252,17 +351,17 @@ int main()
     {
         for (int j = 0; j < NUM_VOLUMES; j++)
         {
-            int volumeAtual = VOLUMES_TESTE[j];
+            size_t volumeAtual = VOLUMES_TESTE[j];
             double somaTempos = 0.0;
             int testesBemSucedidos = 0;
             size_t memoriaAmostra = 0;
 
-            printf("⏳ Testando %s com %d elementos (%d repetições)...", nomesEstruturas[i], volumeAtual, NUM_REPETICOES);
+            printf("⏳ Testando %s com %zu elementos (%d repetições)...", nomesEstruturas[i], volumeAtual, NUM_REPETICOES);
             fflush(stdout);
 
             for (int k = 0; k < NUM_REPETICOES; k++)
             {
-                ResultadoMedicao res = medirDesempenho(estruturas[i], volumeAtual);
+                ResultadoMedicao res = medirDesempenho(estruturas[i], dados, (int64_t)volumeAtual);
 
                 if (res.ordenadoCorretamente)
                 {
@@ -275,7 +374,7 @@ int main()
                 }
                 else
                 {
-                    printf(" ❌ Erro na ordenação em uma das repetições para %s com %d elementos!\n", nomesEstruturas[i], volumeAtual);
+                    printf(" ❌ Erro na ordenação em uma das repetições para %s com %zu elementos!\n", nomesEstruturas[i], volumeAtual);
                     somaTempos = -1.0;
                     memoriaAmostra = 0;
                     break;
@@ -294,16 +393,18 @@ int main()
                 resultadosMemoria[i][j] = 0;
                 if (somaTempos != -1.0)
                 {
-                    printf(" ❌ Nenhuma repetição bem-sucedida para %s com %d elementos.\n", nomesEstruturas[i], volumeAtual);
+                    printf(" ❌ Nenhuma repetição bem-sucedida para %s com %zu elementos.\n", nomesEstruturas[i], volumeAtual);
                 }
             }
         }
     }
 
-    ResultadoMedicao resultadoTeste = medirDesempenho(PILHA_LINEAR, 100);
+    ResultadoMedicao resultadoTeste = medirDesempenho(PILHA_LINEAR, dados, 100);
     resultadosTempo[2][0] = resultadoTeste.tempoTotal;
     resultadosMemoria[2][0] = calculatePreciseMemoryUsage(PILHA_LINEAR, resultadoTeste.numElementos);
     exibirTabelaResumoFinal(resultadosTempo, resultadosMemoria, nomesEstruturas);
 
+    destroyCSVData(dados);
+
     return 0;
 }
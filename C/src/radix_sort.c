@@ -4,7 +4,7 @@
 #include "radix_sort.h"
 #include "counting_sort.h" // Para usar findMax
 
-void radixSort(int *array, int size)
+void radixSort(int *array, size_t size)
 {
     if (!array || size <= 1)
         return;
@@ -15,15 +15,16 @@ void radixSort(int *array, int size)
         return; // Proteção contra valores inválidos
 
     // Aplicar counting sort para cada dígito
-    // exp é 10^i onde i é o dígito atual (1, 10, 100, ...)
-    for (int exp = 1; max / exp > 0; exp *= 10)
+    // exp é 10^i onde i é o dígito atual (1, 10, 100, ...); em 64 bits
+    // para não estourar após 10^9 quando max tem 10 dígitos
+    for (int64_t exp = 1; max / exp > 0; exp *= 10)
     {
         countingSortByDigit(array, size, exp);
     }
 }
 
 // Função auxiliar para counting sort baseado em um dígito específico
-void countingSortByDigit(int *array, int size, int exp)
+void countingSortByDigit(int *array, size_t size, int64_t exp)
 {
     if (!array || size <= 1)
         return;
@@ -35,12 +36,12 @@ void countingSortByDigit(int *array, int size, int exp)
         return;
     }
 
-    int count[10] = {0}; // Array para contar dígitos 0-9
+    size_t count[10] = {0}; // Array para contar dígitos 0-9
 
     // Contar occorrências de cada dígito na posição exp
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
-        int digit = (array[i] / exp) % 10;
+        int digit = (int)((array[i] / exp) % 10);
         count[digit]++;
     }
 
@@ -53,15 +54,15 @@ void countingSortByDigit(int *array, int size, int exp)
 
     // Construir o array output
     // Processar de trás para frente para manter estabilidade
-    for (int i = size - 1; i >= 0; i--)
+    for (size_t i = size; i-- > 0;)
     {
-        int digit = (array[i] / exp) % 10;
+        int digit = (int)((array[i] / exp) % 10);
         output[count[digit] - 1] = array[i];
         count[digit]--;
     }
 
     // Copiar o array output de volta para o array original
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         array[i] = output[i];
     }
@@ -70,12 +71,12 @@ void countingSortByDigit(int *array, int size, int exp)
 }
 
 // Função adicional para verificar se o radix sort funcionou corretamente
-int verifyRadixSort(int *array, int size)
+int verifyRadixSort(int *array, size_t size)
 {
     if (!array || size <= 1)
         return 1;
 
-    for (int i = 1; i < size; i++)
+    for (size_t i = 1; i < size; i++)
     {
         if (array[i] < array[i - 1])
         {
@@ -86,9 +87,9 @@ int verifyRadixSort(int *array, int size)
 }
 
 // Função para imprimir estatísticas do radix sort
-void printRadixSortStats(int *array, int size)
+void printRadixSortStats(int *array, size_t size)
 {
-    if (!array || size <= 0)
+    if (!array || size == 0)
         return;
 
     int max = findMax(array, size);
@@ -3,8 +3,9 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include "counting_sort.h"
 #include "data_structures.h"
-void radixSort(int *array, int size);
-void countingSortByDigit(int *array, int size, int exp);
+void radixSort(int *array, size_t size);
+void countingSortByDigit(int *array, size_t size, int64_t exp);
 #endif
\ No newline at end of file
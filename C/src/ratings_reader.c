@@ -1,352 +1,189 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "ratings_reader.h"
+#include "input_stream.h"
+#include "converters.h"
 #include "data_structures.h"
 #include "config.h"
 
-// ========== LEITURA PARA ESTRUTURAS LINEARES ==========
+// ========== PARSING DE LINHA (SEM SSCANF) ==========
 
-int lerDados_LinearList(LinearList **list, int maxLines, TipoDado tipoDado)
+// Lê um inteiro decimal; retorna ponteiro após o último dígito ou NULL
+static const char *lerInteiro(const char *p, long *valor)
 {
-    FILE *file = fopen(ARQUIVO_ENTRADA, "r");
-    if (!file)
+    int negativo = 0;
+    if (*p == '-')
     {
-        printf("Erro ao abrir arquivo: %s\n", ARQUIVO_ENTRADA);
-        return -1;
+        negativo = 1;
+        p++;
     }
+    if (*p < '0' || *p > '9')
+        return NULL;
 
-    *list = createLinearList(maxLines);
-    char linha[256];
-    int contador = 0;
-    int userId, movieId;
-    float rating;
-    long timestamp;
-
-    // Pular cabeçalho
-    if (!fgets(linha, sizeof(linha), file))
+    long v = 0;
+    while (*p >= '0' && *p <= '9')
     {
-        fclose(file);
-        return -1;
+        if (v > (LONG_MAX - 9) / 10)
+            return NULL;
+        v = v * 10 + (*p - '0');
+        p++;
     }
 
-    const char *tipoStr = (tipoDado == MOVIE_IDS) ? "Movie IDs" : "Ratings";
-    printf("Lendo %s para Lista Linear...\n", tipoStr);
-
-    while (fgets(linha, sizeof(linha), file) && contador < maxLines)
-    {
-        if (sscanf(linha, "%d,%d,%f,%ld", &userId, &movieId, &rating, &timestamp) == 4)
-        {
-            int valor;
-            if (tipoDado == MOVIE_IDS)
-            {
-                valor = movieId;
-            }
-            else // RATINGS
-            {
-                valor = (int)(rating * 2); // Multiplicar por 2 para converter para int
-            }
-
-            appendLinearList(*list, valor);
-            contador++;
-        }
-    }
-
-    fclose(file);
-    printf("Total de %d %s lidos para Lista Linear.\n", contador, tipoStr);
-    return contador;
+    *valor = negativo ? -v : v;
+    return p;
 }
 
-int lerDados_LinearStack(LinearStack **stack, int maxLines, TipoDado tipoDado)
+// Extrai o valor da linha userId,movieId,rating,timestamp; 0 se inválida
+static int extrairValor(const char *linha, TipoDado tipoDado, int *valor)
 {
-    FILE *file = fopen(ARQUIVO_ENTRADA, "r");
-    if (!file)
-    {
-        printf("Erro ao abrir arquivo: %s\n", ARQUIVO_ENTRADA);
-        return -1;
-    }
-
-    *stack = createLinearStack(maxLines);
-    char linha[256];
-    int contador = 0;
-    int userId, movieId;
-    float rating;
-    long timestamp;
-
-    // Pular cabeçalho
-    if (!fgets(linha, sizeof(linha), file))
-    {
-        fclose(file);
-        return -1;
-    }
+    long userId, movieId, parteInteira, timestamp;
 
-    const char *tipoStr = (tipoDado == MOVIE_IDS) ? "Movie IDs" : "Ratings";
-    printf("Lendo %s para Pilha Linear...\n", tipoStr);
+    const char *p = lerInteiro(linha, &userId);
+    if (!p || *p++ != ',')
+        return 0;
 
-    while (fgets(linha, sizeof(linha), file) && contador < maxLines)
-    {
-        if (sscanf(linha, "%d,%d,%f,%ld", &userId, &movieId, &rating, &timestamp) == 4)
-        {
-            int valor;
-            if (tipoDado == MOVIE_IDS)
-            {
-                valor = movieId;
-            }
-            else // RATINGS
-            {
-                valor = (int)(rating * 2);
-            }
-
-            pushLinear(*stack, valor);
-            contador++;
-        }
-    }
+    p = lerInteiro(p, &movieId);
+    if (!p || *p++ != ',' || movieId > INT_MAX || movieId < INT_MIN)
+        return 0;
 
-    fclose(file);
-    printf("Total de %d %s lidos para Pilha Linear.\n", contador, tipoStr);
-    return contador;
-}
+    p = lerInteiro(p, &parteInteira);
+    if (!p || parteInteira > INT_MAX / 2 || parteInteira < INT_MIN / 2)
+        return 0;
 
-int lerDados_LinearQueue(LinearQueue **queue, int maxLines, TipoDado tipoDado)
-{
-    FILE *file = fopen(ARQUIVO_ENTRADA, "r");
-    if (!file)
+    // Equivalente a (int)(rating * 2): soma 1 quando a parte decimal é >= 0.5
+    int meio = 0;
+    if (*p == '.')
     {
-        printf("Erro ao abrir arquivo: %s\n", ARQUIVO_ENTRADA);
-        return -1;
+        p++;
+        if (*p >= '5' && *p <= '9')
+            meio = 1;
+        while (*p >= '0' && *p <= '9')
+            p++;
     }
 
-    *queue = createLinearQueue(maxLines);
-    char linha[256];
-    int contador = 0;
-    int userId, movieId;
-    float rating;
-    long timestamp;
-
-    // Pular cabeçalho
-    if (!fgets(linha, sizeof(linha), file))
-    {
-        fclose(file);
-        return -1;
-    }
-
-    const char *tipoStr = (tipoDado == MOVIE_IDS) ? "Movie IDs" : "Ratings";
-    printf("Lendo %s para Fila Linear...\n", tipoStr);
-
-    while (fgets(linha, sizeof(linha), file) && contador < maxLines)
-    {
-        if (sscanf(linha, "%d,%d,%f,%ld", &userId, &movieId, &rating, &timestamp) == 4)
-        {
-            int valor;
-            if (tipoDado == MOVIE_IDS)
-            {
-                valor = movieId;
-            }
-            else // RATINGS
-            {
-                valor = (int)(rating * 2);
-            }
-
-            enqueueLinear(*queue, valor);
-            contador++;
-        }
-    }
+    if (*p++ != ',' || !lerInteiro(p, &timestamp))
+        return 0;
 
-    fclose(file);
-    printf("Total de %d %s lidos para Fila Linear.\n", contador, tipoStr);
-    return contador;
+    *valor = (tipoDado == MOVIE_IDS) ? (int)movieId : (int)(parteInteira * 2 + meio);
+    return 1;
 }
 
-// ========== LEITURA PARA ESTRUTURAS DINÂMICAS ==========
+// ========== LEITURA ÚNICA PARA BUFFER DE COLUNA ==========
 
-int lerDados_LinkedList(LinkedList **list, int maxLines, TipoDado tipoDado)
+CSVData *lerDados_CSV(const char *arquivo, int64_t maxLines, TipoDado tipoDado)
 {
-    FILE *file = fopen(ARQUIVO_ENTRADA, "r");
+    InputStream *file = openInputStream(arquivo);
     if (!file)
     {
-        printf("Erro ao abrir arquivo: %s\n", ARQUIVO_ENTRADA);
-        return -1;
+        printf("Erro ao abrir arquivo: %s\n", arquivo);
+        return NULL;
     }
 
-    *list = createList();
-    char linha[256];
-    int contador = 0;
-    int userId, movieId;
-    float rating;
-    long timestamp;
-
-    // Pular cabeçalho
-    if (!fgets(linha, sizeof(linha), file))
+    CSVData *dados = (CSVData *)malloc(sizeof(CSVData));
+    if (!dados)
     {
-        fclose(file);
-        return -1;
+        closeInputStream(file);
+        return NULL;
     }
 
-    const char *tipoStr = (tipoDado == MOVIE_IDS) ? "Movie IDs" : "Ratings";
-    printf("Lendo %s para Lista Ligada...\n", tipoStr);
-
-    // Ler todos os dados primeiro em um array temporário
-    int *tempArray = (int *)malloc(maxLines * sizeof(int));
-
-    while (fgets(linha, sizeof(linha), file) && contador < maxLines)
+    dados->capacity = (maxLines > 0) ? (size_t)maxLines : (size_t)1 << 20;
+    dados->count = 0;
+    dados->ratings = (int *)malloc(dados->capacity * sizeof(int));
+    if (!dados->ratings)
     {
-        if (sscanf(linha, "%d,%d,%f,%ld", &userId, &movieId, &rating, &timestamp) == 4)
-        {
-            int valor;
-            if (tipoDado == MOVIE_IDS)
-            {
-                valor = movieId;
-            }
-            else // RATINGS
-            {
-                valor = (int)(rating * 2);
-            }
-
-            tempArray[contador] = valor;
-            contador++;
-        }
+        free(dados);
+        closeInputStream(file);
+        return NULL;
     }
 
-    // Inserir na lista ligada em ordem reversa para manter ordem original
-    for (int i = contador - 1; i >= 0; i--)
-    {
-        insertList(*list, tempArray[i]);
-    }
-
-    free(tempArray);
-    fclose(file);
-    printf("Total de %d %s lidos para Lista Ligada.\n", contador, tipoStr);
-    return contador;
-}
-
-int lerDados_Stack(Stack **stack, int maxLines, TipoDado tipoDado)
-{
-    FILE *file = fopen(ARQUIVO_ENTRADA, "r");
-    if (!file)
-    {
-        printf("Erro ao abrir arquivo: %s\n", ARQUIVO_ENTRADA);
-        return -1;
-    }
-
-    *stack = createStack(maxLines);
     char linha[256];
-    int contador = 0;
-    int userId, movieId;
-    float rating;
-    long timestamp;
 
     // Pular cabeçalho
-    if (!fgets(linha, sizeof(linha), file))
+    if (!readLineInputStream(file, linha, sizeof(linha)))
     {
-        fclose(file);
-        return -1;
+        closeInputStream(file);
+        return dados;
     }
 
     const char *tipoStr = (tipoDado == MOVIE_IDS) ? "Movie IDs" : "Ratings";
-    printf("Lendo %s para Pilha Dinâmica...\n", tipoStr);
+    printf("Lendo %s de %s...\n", tipoStr, arquivo);
 
-    while (fgets(linha, sizeof(linha), file) && contador < maxLines)
+    while ((maxLines <= 0 || dados->count < (size_t)maxLines) &&
+           readLineInputStream(file, linha, sizeof(linha)))
     {
-        if (sscanf(linha, "%d,%d,%f,%ld", &userId, &movieId, &rating, &timestamp) == 4)
+        int valor;
+        if (!extrairValor(linha, tipoDado, &valor))
+            continue;
+
+        if (dados->count == dados->capacity)
         {
-            int valor;
-            if (tipoDado == MOVIE_IDS)
-            {
-                valor = movieId;
-            }
-            else // RATINGS
-            {
-                valor = (int)(rating * 2);
-            }
-
-            push(*stack, valor);
-            contador++;
+            int *maior = (int *)realloc(dados->ratings, dados->capacity * 2 * sizeof(int));
+            if (!maior)
+                break;
+            dados->ratings = maior;
+            dados->capacity *= 2;
         }
-    }
-
-    fclose(file);
-    printf("Total de %d %s lidos para Pilha Dinâmica.\n", contador, tipoStr);
-    return contador;
-}
 
-int lerDados_Queue(Queue **queue, int maxLines, TipoDado tipoDado)
-{
-    FILE *file = fopen(ARQUIVO_ENTRADA, "r");
-    if (!file)
-    {
-        printf("Erro ao abrir arquivo: %s\n", ARQUIVO_ENTRADA);
-        return -1;
+        dados->ratings[dados->count++] = valor;
     }
 
-    *queue = createQueue(maxLines);
-    char linha[256];
-    int contador = 0;
-    int userId, movieId;
-    float rating;
-    long timestamp;
-
-    // Pular cabeçalho
-    if (!fgets(linha, sizeof(linha), file))
+    // Arquivo truncado ou corrompido antes de maxLines: não entrega dados parciais
+    if (hasErrorInputStream(file) && (maxLines <= 0 || dados->count < (size_t)maxLines))
     {
-        fclose(file);
-        return -1;
+        printf("Erro de leitura/descompressão em %s, arquivo truncado ou corrompido.\n", arquivo);
+        closeInputStream(file);
+        destroyCSVData(dados);
+        return NULL;
     }
 
-    const char *tipoStr = (tipoDado == MOVIE_IDS) ? "Movie IDs" : "Ratings";
-    printf("Lendo %s para Fila Dinâmica...\n", tipoStr);
-
-    while (fgets(linha, sizeof(linha), file) && contador < maxLines)
-    {
-        if (sscanf(linha, "%d,%d,%f,%ld", &userId, &movieId, &rating, &timestamp) == 4)
-        {
-            int valor;
-            if (tipoDado == MOVIE_IDS)
-            {
-                valor = movieId;
-            }
-            else // RATINGS
-            {
-                valor = (int)(rating * 2);
-            }
-
-            enqueue(*queue, valor);
-            contador++;
-        }
-    }
-
-    fclose(file);
-    printf("Total de %d %s lidos para Fila Dinâmica.\n", contador, tipoStr);
-    return contador;
+    closeInputStream(file);
+    printf("Total de %zu %s lidos.\n", dados->count, tipoStr);
+    return dados;
 }
 
-// ========== FUNÇÃO PRINCIPAL PARA ESCOLHER O TIPO DE LEITURA ==========
+// ========== PREENCHIMENTO DAS ESTRUTURAS A PARTIR DA MEMÓRIA ==========
 
-int lerDados_PorTipo(void **estrutura, TipoEstrutura tipo, TipoDado tipoDado, int maxLines)
+int64_t preencherEstrutura(void **estrutura, TipoEstrutura tipo, CSVData *dados, int64_t maxLines)
 {
+    if (!dados || dados->count == 0)
+        return -1;
+
+    size_t quantidade = (maxLines > 0 && (size_t)maxLines < dados->count) ? (size_t)maxLines : dados->count;
+
     switch (tipo)
     {
     case LISTA_LINEAR:
-        return lerDados_LinearList((LinearList **)estrutura, maxLines, tipoDado);
+        *estrutura = arrayToLinearList(dados->ratings, quantidade);
+        break;
 
     case LISTA_DINAMICA:
-        return lerDados_LinkedList((LinkedList **)estrutura, maxLines, tipoDado);
+        *estrutura = arrayToList(dados->ratings, quantidade);
+        break;
 
     case PILHA_LINEAR:
-        return lerDados_LinearStack((LinearStack **)estrutura, maxLines, tipoDado);
+        *estrutura = arrayToLinearStack(dados->ratings, quantidade);
+        break;
 
     case PILHA_DINAMICA:
-        return lerDados_Stack((Stack **)estrutura, maxLines, tipoDado);
+        *estrutura = arrayToStack(dados->ratings, quantidade);
+        break;
 
     case FILA_LINEAR:
-        return lerDados_LinearQueue((LinearQueue **)estrutura, maxLines, tipoDado);
+        *estrutura = arrayToLinearQueue(dados->ratings, quantidade);
+        break;
 
     case FILA_DINAMICA:
-        return lerDados_Queue((Queue **)estrutura, maxLines, tipoDado);
+        *estrutura = arrayToQueue(dados->ratings, quantidade);
+        break;
 
     default:
         printf("Tipo de estrutura inválido!\n");
         return -1;
     }
+
+    return *estrutura ? (int64_t)quantidade : -1;
 }
 
 // ========== FUNÇÃO PARA OBTER NOME DA ESTRUTURA ==========
@@ -370,4 +207,4 @@ const char *getNomeEstrutura(TipoEstrutura tipo)
     default:
         return "Desconhecida";
     }
-}
\ No newline at end of file
+}
@@ -2,22 +2,17 @@
 #define RATINGS_READER_H
 
 #include "data_structures.h"
+#include "utils.h"
 #include "config.h"
 
-int lerDados_LinearList(LinearList **list, int maxLines, TipoDado tipoDado);
+// Lê o arquivo uma única vez para um buffer de coluna (CSVData)
+// maxLines <= 0 lê o arquivo inteiro
+CSVData *lerDados_CSV(const char *arquivo, int64_t maxLines, TipoDado tipoDado);
 
-int lerDados_LinearStack(LinearStack **stack, int maxLines, TipoDado tipoDado);
-
-int lerDados_LinearQueue(LinearQueue **queue, int maxLines, TipoDado tipoDado);
-
-int lerDados_LinkedList(LinkedList **list, int maxLines, TipoDado tipoDado);
-
-int lerDados_Stack(Stack **stack, int maxLines, TipoDado tipoDado);
-
-int lerDados_Queue(Queue **queue, int maxLines, TipoDado tipoDado);
-
-int lerDados_PorTipo(void **estrutura, TipoEstrutura tipo, TipoDado tipoDado, int maxLines);
+// Preenche qualquer estrutura a partir do buffer em memória, sem reler o arquivo
+// Retorna a quantidade de elementos inseridos, ou -1 em caso de erro
+int64_t preencherEstrutura(void **estrutura, TipoEstrutura tipo, CSVData *dados, int64_t maxLines);
 
 const char *getNomeEstrutura(TipoEstrutura tipo);
 
-#endif
\ No newline at end of file
+#endif
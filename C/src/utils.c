@@ -4,11 +4,13 @@
 #include <string.h>
 #include "utils.h"
 #include "counting_sort.h"
+#include "converters.h"
+#include "ratings_reader.h"
 
-void printArray(int *array, int size, const char *label)
+void printArray(int *array, size_t size, const char *label)
 {
     printf("%s: ", label);
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         printf("%d ", array[i]);
     }
@@ -27,12 +29,12 @@ void printList(LinkedList *list, const char *label)
     printf("\n");
 }
 
-int *generateRandomArray(int size, int maxValue)
+int *generateRandomArray(size_t size, int maxValue)
 {
     int *array = (int *)malloc(size * sizeof(int));
     srand(time(NULL));
 
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
         array[i] = rand() % (maxValue + 1);
     }
@@ -40,31 +42,31 @@ int *generateRandomArray(int size, int maxValue)
     return array;
 }
 
-int *generateSortedArray(int size)
+int *generateSortedArray(size_t size)
 {
     int *array = (int *)malloc(size * sizeof(int));
 
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
-        array[i] = i;
+        array[i] = (int)i;
     }
 
     return array;
 }
 
-int *generateReverseSortedArray(int size)
+int *generateReverseSortedArray(size_t size)
 {
     int *array = (int *)malloc(size * sizeof(int));
 
-    for (int i = 0; i < size; i++)
+    for (size_t i = 0; i < size; i++)
     {
-        array[i] = size - i - 1;
+        array[i] = (int)(size - i - 1);
     }
 
     return array;
 }
 
-double measureTime(void (*sortFunction)(int *, int), int *array, int size)
+double measureTime(void (*sortFunction)(int *, size_t), int *array, size_t size)
 {
     // Criar cópia do array para não alterar o original
     int *arrayCopy = (int *)malloc(size * sizeof(int));
@@ -78,4 +80,28 @@ double measureTime(void (*sortFunction)(int *, int), int *array, int size)
 
     free(arrayCopy);
     return time_taken;
-}
\ No newline at end of file
+}
+// ========== FUNÇÕES PARA ANÁLISE DE DADOS CSV ==========
+
+CSVData *loadCSVRatings(const char *filename, int64_t max_records)
+{
+    return lerDados_CSV(filename, max_records, RATINGS);
+}
+
+void destroyCSVData(CSVData *data)
+{
+    if (!data)
+        return;
+
+    free(data->ratings);
+    free(data);
+}
+
+int *getCSVSubset(CSVData *data, size_t size)
+{
+    if (!data)
+        return NULL;
+
+    size_t quantidade = (size < data->count) ? size : data->count;
+    return copyArray(data->ratings, quantidade);
+}
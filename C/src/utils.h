@@ -9,58 +9,58 @@ typedef struct
 {
     double time_seconds;
     long memory_peak_kb;
-    int comparisons;
-    int swaps;
+    int64_t comparisons;
+    int64_t swaps;
 } PerformanceMetrics;
 
 typedef struct
 {
     char structure_name[50];
     char representation[20]; // "dynamic" ou "linear"
-    int data_size;
+    size_t data_size;
     PerformanceMetrics metrics;
 } BenchmarkResult;
 
 // ========== FUNÇÕES DE IMPRESSÃO ==========
 
-void printArray(int *array, int size, const char *label);
+void printArray(int *array, size_t size, const char *label);
 void printList(LinkedList *list, const char *label);
 void printLinearList(LinearList *list, const char *label);
 
 // ========== FUNÇÕES DE GERAÇÃO DE DADOS ==========
 
-int *generateRandomArray(int size, int maxValue);
-int *generateSortedArray(int size);
-int *generateReverseSortedArray(int size);
-int *generatePartiallyOrderedArray(int size, float orderPercentage);
+int *generateRandomArray(size_t size, int maxValue);
+int *generateSortedArray(size_t size);
+int *generateReverseSortedArray(size_t size);
+int *generatePartiallyOrderedArray(size_t size, float orderPercentage);
 
 // ========== FUNÇÕES DE MEDIÇÃO DE PERFORMANCE ==========
 
-double measureTime(void (*sortFunction)(int *, int), int *array, int size);
+double measureTime(void (*sortFunction)(int *, size_t), int *array, size_t size);
 long measureMemoryUsage();
-PerformanceMetrics measurePerformanceComplete(void (*sortFunction)(int *, int), int *array, int size);
+PerformanceMetrics measurePerformanceComplete(void (*sortFunction)(int *, size_t), int *array, size_t size);
 
 // ========== FUNÇÕES PARA ANÁLISE DE DADOS CSV ==========
 
 typedef struct
 {
     int *ratings;
-    int count;
-    int capacity;
+    size_t count;
+    size_t capacity;
 } CSVData;
 
-CSVData *loadCSVRatings(const char *filename, int max_records);
+CSVData *loadCSVRatings(const char *filename, int64_t max_records);
 void destroyCSVData(CSVData *data);
-int *getCSVSubset(CSVData *data, int size);
+int *getCSVSubset(CSVData *data, size_t size);
 
 // ========== FUNÇÕES DE BENCHMARK SISTEMÁTICO ==========
 
-void benchmarkAllStructures(int data_sizes[], int num_sizes, const char *output_file);
-void benchmarkSingleStructure(const char *structure_name, int *test_data, int size, BenchmarkResult *result);
+void benchmarkAllStructures(size_t data_sizes[], int num_sizes, const char *output_file);
+void benchmarkSingleStructure(const char *structure_name, int *test_data, size_t size, BenchmarkResult *result);
 void exportBenchmarkResults(BenchmarkResult *results, int num_results, const char *filename);
 
 // ========== FUNÇÕES DE VALIDAÇÃO ==========
 
-int validateSortedArray(int *array, int size);
-int compareArrays(int *array1, int *array2, int size);
+int validateSortedArray(int *array, size_t size);
+int compareArrays(int *array1, int *array2, size_t size);
 #endif
\ No newline at end of file